@@ -0,0 +1,318 @@
+// [[cpp11::linking_to("cgal4h")]]
+// [[cpp11::linking_to("BH")]]
+
+// Compiled by kernels.R against the headers in src/ of the package sources,
+// so the benchmarks are not part of the installed package
+
+#include "cgal_types.h"
+#include "geometry_vector.h"
+#include "intersection.h"
+#include "distance.h"
+#include "match.h"
+
+#include <cpp11/list.hpp>
+#include <cpp11/strings.hpp>
+#include <cpp11/doubles.hpp>
+#include <cpp11/integers.hpp>
+
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <algorithm>
+
+// Microbenchmarks of the _impl template families. Each kernel is timed on
+// "raw" input created directly from doubles and on "derived" input that is
+// the result of a construction (and thus carries a lazy construction history).
+// Input is generated anew for every repetition so cached exact values do not
+// carry over between repetitions
+
+typedef std::mt19937 Bench_rng;
+
+class Bench_data {
+  Bench_rng& _rng;
+  bool _derived;
+  std::uniform_real_distribution<double> _unif;
+
+public:
+  Bench_data(Bench_rng& rng, bool derived) : _rng(rng), _derived(derived), _unif(-1.0, 1.0) {}
+
+  Kernel::FT number() {
+    Kernel::FT x = _unif(_rng);
+    if (_derived) {
+      return x / 3;
+    }
+    return x;
+  }
+  Kernel::FT positive() {
+    Kernel::FT x = std::abs(_unif(_rng)) + 0.1;
+    if (_derived) {
+      return x / 3;
+    }
+    return x;
+  }
+  Kernel::Point_2 point_2() {
+    return Kernel::Point_2(number(), number());
+  }
+  Kernel::Point_3 point_3() {
+    return Kernel::Point_3(number(), number(), number());
+  }
+};
+
+template<typename T>
+inline T bench_geometry(Bench_data& data);
+template<>
+inline Point_2 bench_geometry<Point_2>(Bench_data& data) {
+  return data.point_2();
+}
+template<>
+inline Point_3 bench_geometry<Point_3>(Bench_data& data) {
+  return data.point_3();
+}
+template<>
+inline Segment_2 bench_geometry<Segment_2>(Bench_data& data) {
+  return Kernel::Segment_2(data.point_2(), data.point_2());
+}
+template<>
+inline Segment_3 bench_geometry<Segment_3>(Bench_data& data) {
+  return Kernel::Segment_3(data.point_3(), data.point_3());
+}
+template<>
+inline Triangle_2 bench_geometry<Triangle_2>(Bench_data& data) {
+  return Kernel::Triangle_2(data.point_2(), data.point_2(), data.point_2());
+}
+template<>
+inline Triangle_3 bench_geometry<Triangle_3>(Bench_data& data) {
+  return Kernel::Triangle_3(data.point_3(), data.point_3(), data.point_3());
+}
+template<>
+inline Circle_2 bench_geometry<Circle_2>(Bench_data& data) {
+  return Kernel::Circle_2(data.point_2(), data.positive());
+}
+template<>
+inline Sphere bench_geometry<Sphere>(Bench_data& data) {
+  return Kernel::Sphere_3(data.point_3(), data.positive());
+}
+template<>
+inline Iso_rectangle bench_geometry<Iso_rectangle>(Bench_data& data) {
+  return Kernel::Iso_rectangle_2(data.point_2(), data.point_2());
+}
+template<>
+inline Tetrahedron bench_geometry<Tetrahedron>(Bench_data& data) {
+  return Kernel::Tetrahedron_3(data.point_3(), data.point_3(), data.point_3(), data.point_3());
+}
+template<>
+inline Exact_number bench_geometry<Exact_number>(Bench_data& data) {
+  return data.number();
+}
+template<>
+inline Aff_transformation_2 bench_geometry<Aff_transformation_2>(Bench_data& data) {
+  return Kernel::Aff_transformation_2(
+    data.number(), data.number(), data.number(),
+    data.number(), data.number(), data.number()
+  );
+}
+template<>
+inline Aff_transformation_3 bench_geometry<Aff_transformation_3>(Bench_data& data) {
+  return Kernel::Aff_transformation_3(
+    data.number(), data.number(), data.number(), data.number(),
+    data.number(), data.number(), data.number(), data.number(),
+    data.number(), data.number(), data.number(), data.number()
+  );
+}
+
+template<typename T>
+inline std::vector<T> bench_vector(Bench_data& data, size_t n) {
+  std::vector<T> result;
+  result.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    result.push_back(bench_geometry<T>(data));
+  }
+  return result;
+}
+
+// Kernels. Each returns a value depending on the result so the work cannot be
+// optimised away
+
+template<typename T, typename U>
+struct Bench_has_inside {
+  std::vector<T> x;
+  std::vector<U> y;
+  void setup(Bench_data& data, size_t n) {
+    x = bench_vector<T>(data, n);
+    y = bench_vector<U>(data, n);
+  }
+  double run() const {
+    double sink = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+      sink += has_inside_impl(x[i], y[i]);
+    }
+    return sink;
+  }
+};
+
+template<typename T>
+struct Bench_length {
+  std::vector<T> x;
+  void setup(Bench_data& data, size_t n) {
+    x = bench_vector<T>(data, n);
+  }
+  double run() const {
+    double sink = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+      sink += length_impl(x[i]);
+    }
+    return sink;
+  }
+};
+
+template<typename T, typename Aff>
+struct Bench_transform {
+  std::vector<T> x;
+  std::vector<Aff> trans;
+  void setup(Bench_data& data, size_t n) {
+    x = bench_vector<T>(data, n);
+    trans = bench_vector<Aff>(data, n);
+  }
+  double run() const {
+    double sink = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+      sink += static_cast<bool>(transform_impl(x[i], trans[i]));
+    }
+    return sink;
+  }
+};
+
+template<typename T, typename U>
+struct Bench_intersection {
+  std::vector<T> x;
+  std::vector<U> y;
+  void setup(Bench_data& data, size_t n) {
+    x = bench_vector<T>(data, n);
+    y = bench_vector<U>(data, n);
+  }
+  double run() const {
+    return intersection_impl(x, y).size();
+  }
+};
+
+template<typename T, typename U>
+struct Bench_squared_distance {
+  std::vector<T> x;
+  std::vector<U> y;
+  void setup(Bench_data& data, size_t n) {
+    x = bench_vector<T>(data, n);
+    y = bench_vector<U>(data, n);
+  }
+  double run() const {
+    std::vector<Exact_number> dist = squared_distance_impl(x, y);
+    double sink = 0;
+    for (size_t i = 0; i < dist.size(); ++i) {
+      sink += dist[i] > 0.5;
+    }
+    return sink;
+  }
+};
+
+template<typename T>
+struct Bench_match {
+  std::vector<T> x;
+  std::vector<T> table;
+  void setup(Bench_data& data, size_t n) {
+    table = bench_vector<T>(data, n);
+    // Half of the elements are found in the table
+    x = bench_vector<T>(data, n);
+    for (size_t i = 0; i < n; i += 2) {
+      x[i] = table[(i * 7) % n];
+    }
+  }
+  double run() const {
+    return match_impl(x, table).size();
+  }
+};
+
+struct Bench_results {
+  cpp11::writable::strings kernel;
+  cpp11::writable::strings type;
+  cpp11::writable::strings input;
+  cpp11::writable::integers size;
+  cpp11::writable::doubles seconds;
+  cpp11::writable::doubles ns_per_element;
+  double sink = 0;
+
+  template<typename Bench>
+  void run(const char* kernel_name, const char* type_name, Bench_rng& rng, size_t n, int reps) {
+    for (int derived = 0; derived < 2; ++derived) {
+      std::vector<double> timings;
+      timings.reserve(reps);
+      for (int r = 0; r < reps; ++r) {
+        Bench_data data(rng, derived);
+        Bench bench;
+        bench.setup(data, n);
+        auto start = std::chrono::steady_clock::now();
+        sink += bench.run();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        timings.push_back(elapsed.count());
+      }
+      std::sort(timings.begin(), timings.end());
+      double median = timings[timings.size() / 2];
+      kernel.push_back(kernel_name);
+      type.push_back(type_name);
+      input.push_back(derived ? "derived" : "raw");
+      size.push_back(n);
+      seconds.push_back(median);
+      ns_per_element.push_back(median * 1e9 / n);
+    }
+  }
+};
+
+[[cpp11::register]]
+cpp11::writable::list benchmark_kernels(cpp11::integers sizes, int reps, int seed) {
+  if (reps < 1) {
+    cpp11::stop("At least one repetition is required");
+  }
+  Bench_rng rng(seed);
+  Bench_results res;
+
+  for (R_xlen_t k = 0; k < sizes.size(); ++k) {
+    if (sizes[k] == R_NaInt || sizes[k] < 1) {
+      continue;
+    }
+    size_t n = sizes[k];
+
+    res.run< Bench_has_inside<Triangle_2, Point_2> >("has_inside_impl", "triangle_2,point_2", rng, n, reps);
+    res.run< Bench_has_inside<Circle_2, Point_2> >("has_inside_impl", "circle_2,point_2", rng, n, reps);
+    res.run< Bench_has_inside<Iso_rectangle, Point_2> >("has_inside_impl", "iso_rect,point_2", rng, n, reps);
+    res.run< Bench_has_inside<Sphere, Point_3> >("has_inside_impl", "sphere,point_3", rng, n, reps);
+    res.run< Bench_has_inside<Tetrahedron, Point_3> >("has_inside_impl", "tetrahedron,point_3", rng, n, reps);
+
+    res.run< Bench_length<Segment_2> >("length_impl", "segment_2", rng, n, reps);
+    res.run< Bench_length<Segment_3> >("length_impl", "segment_3", rng, n, reps);
+    res.run< Bench_length<Triangle_2> >("length_impl", "triangle_2", rng, n, reps);
+    res.run< Bench_length<Circle_2> >("length_impl", "circle_2", rng, n, reps);
+
+    res.run< Bench_transform<Point_2, Aff_transformation_2> >("transform_impl", "point_2", rng, n, reps);
+    res.run< Bench_transform<Segment_2, Aff_transformation_2> >("transform_impl", "segment_2", rng, n, reps);
+    res.run< Bench_transform<Triangle_2, Aff_transformation_2> >("transform_impl", "triangle_2", rng, n, reps);
+    res.run< Bench_transform<Point_3, Aff_transformation_3> >("transform_impl", "point_3", rng, n, reps);
+    res.run< Bench_transform<Triangle_3, Aff_transformation_3> >("transform_impl", "triangle_3", rng, n, reps);
+
+    res.run< Bench_intersection<Segment_2, Segment_2> >("intersection_impl", "segment_2,segment_2", rng, n, reps);
+    res.run< Bench_intersection<Triangle_2, Segment_2> >("intersection_impl", "triangle_2,segment_2", rng, n, reps);
+    res.run< Bench_intersection<Triangle_3, Segment_3> >("intersection_impl", "triangle_3,segment_3", rng, n, reps);
+
+    res.run< Bench_squared_distance<Point_2, Point_2> >("squared_distance_impl", "point_2,point_2", rng, n, reps);
+    res.run< Bench_squared_distance<Segment_2, Point_2> >("squared_distance_impl", "segment_2,point_2", rng, n, reps);
+    res.run< Bench_squared_distance<Triangle_3, Point_3> >("squared_distance_impl", "triangle_3,point_3", rng, n, reps);
+
+    res.run< Bench_match<Point_2> >("match_impl", "point_2", rng, n, reps);
+    res.run< Bench_match<Point_3> >("match_impl", "point_3", rng, n, reps);
+    res.run< Bench_match<Exact_number> >("match_impl", "exact_numeric", rng, n, reps);
+  }
+
+  if (res.sink == -1) {
+    cpp11::warning("Unexpected benchmark result");
+  }
+
+  return {res.kernel, res.type, res.input, res.size, res.seconds, res.ns_per_element};
+}
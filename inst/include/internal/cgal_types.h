@@ -54,6 +54,14 @@ private:
   bool _valid = true;
 };
 
+// Threading: all algorithms run on the calling thread. The lazy numbers of the
+// Epeck kernel are reference counted handles without synchronisation and their
+// exact value is computed (and the construction history released) on first
+// access, so even read-only use of values shared between elements would race.
+// As elements routinely share nodes (e.g. the results of a transformation all
+// reference the same matrix entries) work on them cannot be split across
+// threads, and CGAL's parallel algorithms (which also require TBB) are not
+// available with this kernel
 typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
 typedef with_NA<Kernel::FT> Exact_number;
 typedef with_NA<Kernel::Circle_2> Circle_2;
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "cgal_types.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+// Rounds all defining values of a geometry according to a rounding policy. The
+// policy provides coord() for point coordinates and vector components, and
+// value() for all other defining values (weights, radii, coefficients, and
+// directions). The result carries no construction history
+
+// The double nearest to x, with ties to even. CGAL::to_double() on a lazy
+// number gives the midpoint of its interval approximation, which is not
+// necessarily the nearest double for constructed values, so unless the
+// interval already pins down a single double the exact value is computed and
+// compared to the midpoint of the two doubles enclosing it
+inline double nearest_double(const Kernel::FT& x) {
+  std::pair<double, double> range = CGAL::to_interval(x);
+  if (range.first == range.second) {
+    return range.first;
+  }
+  typedef Kernel::FT::ET ET;
+  const ET& exact = x.exact();
+  range = CGAL::to_interval(exact);
+  if (range.first == range.second) {
+    return range.first;
+  }
+  if (!std::isfinite(range.first) || !std::isfinite(range.second) ||
+      std::nextafter(range.first, range.second) != range.second) {
+    return CGAL::to_double(exact);
+  }
+  ET mid = (ET(range.first) + ET(range.second)) / 2;
+  if (exact < mid) {
+    return range.first;
+  }
+  if (exact > mid) {
+    return range.second;
+  }
+  uint64_t bits;
+  std::memcpy(&bits, &range.first, sizeof(double));
+  return (bits & 1) == 0 ? range.first : range.second;
+}
+
+// Rounds to the nearest double. The result can be handled by the double
+// precision predicates (see mirror.h)
+struct Round_to_double {
+  Kernel::FT coord(const Kernel::FT& x) const {
+    return nearest_double(x);
+  }
+  Kernel::FT value(const Kernel::FT& x) const {
+    return nearest_double(x);
+  }
+};
+
+template<typename Round>
+inline Kernel::Point_2 round_point(const Kernel::Point_2& p, const Round& round) {
+  return Kernel::Point_2(round.coord(p.x()), round.coord(p.y()));
+}
+template<typename Round>
+inline Kernel::Point_3 round_point(const Kernel::Point_3& p, const Round& round) {
+  return Kernel::Point_3(round.coord(p.x()), round.coord(p.y()), round.coord(p.z()));
+}
+template<typename Round>
+inline Kernel::Plane_3 round_plane(const Kernel::Plane_3& p, const Round& round) {
+  return Kernel::Plane_3(round.value(p.a()), round.value(p.b()), round.value(p.c()), round.value(p.d()));
+}
+template<typename Round>
+inline Kernel::Direction_2 round_direction(const Kernel::Direction_2& d, const Round& round) {
+  return Kernel::Direction_2(round.value(d.dx()), round.value(d.dy()));
+}
+template<typename Round>
+inline Kernel::Direction_3 round_direction(const Kernel::Direction_3& d, const Round& round) {
+  return Kernel::Direction_3(round.value(d.dx()), round.value(d.dy()), round.value(d.dz()));
+}
+
+template<typename T, typename Round>
+inline T round_impl(const T& geometry, const Round& round) {
+  return geometry;
+}
+
+template<typename Round>
+inline Circle_2 round_impl(const Circle_2& geometry, const Round& round) {
+  return Kernel::Circle_2(round_point(geometry.center(), round), round.value(geometry.squared_radius()), geometry.orientation());
+}
+// Rounding the centre on its own would generally move it off the rounded
+// plane, so it is projected back onto it. The centre is thus not necessarily
+// made of doubles
+template<typename Round>
+inline Circle_3 round_impl(const Circle_3& geometry, const Round& round) {
+  Kernel::Plane_3 plane = round_plane(geometry.supporting_plane(), round);
+  Kernel::Point_3 center = plane.projection(round_point(geometry.center(), round));
+  return Kernel::Circle_3(center, round.value(geometry.squared_radius()), plane);
+}
+template<typename Round>
+inline Direction_2 round_impl(const Direction_2& geometry, const Round& round) {
+  return round_direction(geometry, round);
+}
+template<typename Round>
+inline Direction_3 round_impl(const Direction_3& geometry, const Round& round) {
+  return round_direction(geometry, round);
+}
+template<typename Round>
+inline Iso_cuboid round_impl(const Iso_cuboid& geometry, const Round& round) {
+  return Kernel::Iso_cuboid_3(round_point(geometry.min(), round), round_point(geometry.max(), round));
+}
+template<typename Round>
+inline Iso_rectangle round_impl(const Iso_rectangle& geometry, const Round& round) {
+  return Kernel::Iso_rectangle_2(round_point(geometry.min(), round), round_point(geometry.max(), round));
+}
+template<typename Round>
+inline Line_2 round_impl(const Line_2& geometry, const Round& round) {
+  return Kernel::Line_2(round.value(geometry.a()), round.value(geometry.b()), round.value(geometry.c()));
+}
+template<typename Round>
+inline Line_3 round_impl(const Line_3& geometry, const Round& round) {
+  return Kernel::Line_3(round_point(geometry.point(), round), round_direction(geometry.direction(), round));
+}
+template<typename Round>
+inline Plane round_impl(const Plane& geometry, const Round& round) {
+  return round_plane(geometry, round);
+}
+template<typename Round>
+inline Point_2 round_impl(const Point_2& geometry, const Round& round) {
+  return round_point(geometry, round);
+}
+template<typename Round>
+inline Point_3 round_impl(const Point_3& geometry, const Round& round) {
+  return round_point(geometry, round);
+}
+template<typename Round>
+inline Ray_2 round_impl(const Ray_2& geometry, const Round& round) {
+  return Kernel::Ray_2(round_point(geometry.source(), round), round_direction(geometry.direction(), round));
+}
+template<typename Round>
+inline Ray_3 round_impl(const Ray_3& geometry, const Round& round) {
+  return Kernel::Ray_3(round_point(geometry.source(), round), round_direction(geometry.direction(), round));
+}
+template<typename Round>
+inline Segment_2 round_impl(const Segment_2& geometry, const Round& round) {
+  return Kernel::Segment_2(round_point(geometry.source(), round), round_point(geometry.target(), round));
+}
+template<typename Round>
+inline Segment_3 round_impl(const Segment_3& geometry, const Round& round) {
+  return Kernel::Segment_3(round_point(geometry.source(), round), round_point(geometry.target(), round));
+}
+template<typename Round>
+inline Sphere round_impl(const Sphere& geometry, const Round& round) {
+  return Kernel::Sphere_3(round_point(geometry.center(), round), round.value(geometry.squared_radius()), geometry.orientation());
+}
+template<typename Round>
+inline Tetrahedron round_impl(const Tetrahedron& geometry, const Round& round) {
+  return Kernel::Tetrahedron_3(
+    round_point(geometry.vertex(0), round),
+    round_point(geometry.vertex(1), round),
+    round_point(geometry.vertex(2), round),
+    round_point(geometry.vertex(3), round)
+  );
+}
+template<typename Round>
+inline Triangle_2 round_impl(const Triangle_2& geometry, const Round& round) {
+  return Kernel::Triangle_2(
+    round_point(geometry.vertex(0), round),
+    round_point(geometry.vertex(1), round),
+    round_point(geometry.vertex(2), round)
+  );
+}
+template<typename Round>
+inline Triangle_3 round_impl(const Triangle_3& geometry, const Round& round) {
+  return Kernel::Triangle_3(
+    round_point(geometry.vertex(0), round),
+    round_point(geometry.vertex(1), round),
+    round_point(geometry.vertex(2), round)
+  );
+}
+template<typename Round>
+inline Vector_2 round_impl(const Vector_2& geometry, const Round& round) {
+  return Kernel::Vector_2(round.coord(geometry.x()), round.coord(geometry.y()));
+}
+template<typename Round>
+inline Vector_3 round_impl(const Vector_3& geometry, const Round& round) {
+  return Kernel::Vector_3(round.coord(geometry.x()), round.coord(geometry.y()), round.coord(geometry.z()));
+}
+template<typename Round>
+inline Weighted_point_2 round_impl(const Weighted_point_2& geometry, const Round& round) {
+  return Kernel::Weighted_point_2(round_point(geometry.point(), round), round.value(geometry.weight()));
+}
+template<typename Round>
+inline Weighted_point_3 round_impl(const Weighted_point_3& geometry, const Round& round) {
+  return Kernel::Weighted_point_3(round_point(geometry.point(), round), round.value(geometry.weight()));
+}
+
+template<typename T>
+inline T approximate_impl(const T& geometry) {
+  return round_impl(geometry, Round_to_double());
+}
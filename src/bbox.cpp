@@ -1,4 +1,5 @@
 #include "bbox.h"
+#include "spatial_sort.h"
 
 #include <cpp11/doubles.hpp>
 #include <cpp11/strings.hpp>
@@ -37,6 +38,7 @@ const std::vector<Bbox_3> get_vector_of_bbox(const bbox_vector_base& bboxes) {
 
 [[cpp11::register]]
 bbox2_p create_bbox_2(cpp11::doubles xmin, cpp11::doubles ymin, cpp11::doubles xmax, cpp11::doubles ymax) {
+  Profile_scope profile(__func__);
   std::vector<Bbox_2> vec;
   vec.reserve(xmin.size());
   for (int i = 0; i < xmin.size(); ++i) {
@@ -50,6 +52,7 @@ bbox2_p create_bbox_2(cpp11::doubles xmin, cpp11::doubles ymin, cpp11::doubles x
 
 [[cpp11::register]]
 bbox3_p create_bbox_3(cpp11::doubles xmin, cpp11::doubles ymin, cpp11::doubles zmin, cpp11::doubles xmax, cpp11::doubles ymax, cpp11::doubles zmax) {
+  Profile_scope profile(__func__);
   std::vector<Bbox_3> vec;
   vec.reserve(xmin.size());
   for (int i = 0; i < xmin.size(); ++i) {
@@ -63,6 +66,7 @@ bbox3_p create_bbox_3(cpp11::doubles xmin, cpp11::doubles ymin, cpp11::doubles z
 
 [[cpp11::register]]
 int bbox_length(bbox_vector_base_p bboxes) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     return 0;
   }
@@ -71,6 +75,7 @@ int bbox_length(bbox_vector_base_p bboxes) {
 
 [[cpp11::register]]
 int bbox_dimension(bbox_vector_base_p bboxes) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     return 0;
   }
@@ -79,6 +84,7 @@ int bbox_dimension(bbox_vector_base_p bboxes) {
 
 [[cpp11::register]]
 bbox_vector_base_p bbox_subset(bbox_vector_base_p bboxes, cpp11::integers index) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -87,6 +93,7 @@ bbox_vector_base_p bbox_subset(bbox_vector_base_p bboxes, cpp11::integers index)
 
 [[cpp11::register]]
 bbox_vector_base_p bbox_copy(bbox_vector_base_p bboxes) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -95,6 +102,7 @@ bbox_vector_base_p bbox_copy(bbox_vector_base_p bboxes) {
 
 [[cpp11::register]]
 bbox_vector_base_p bbox_assign(bbox_vector_base_p bboxes, cpp11::integers index, bbox_vector_base_p value) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr || value.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -103,6 +111,7 @@ bbox_vector_base_p bbox_assign(bbox_vector_base_p bboxes, cpp11::integers index,
 
 [[cpp11::register]]
 bbox_vector_base_p bbox_combine(bbox_vector_base_p bboxes, cpp11::list_of< bbox_vector_base_p > extra) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -111,6 +120,7 @@ bbox_vector_base_p bbox_combine(bbox_vector_base_p bboxes, cpp11::list_of< bbox_
 
 [[cpp11::register]]
 bbox_vector_base_p bbox_unique(bbox_vector_base_p bboxes) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -119,6 +129,7 @@ bbox_vector_base_p bbox_unique(bbox_vector_base_p bboxes) {
 
 [[cpp11::register]]
 cpp11::writable::logicals bbox_duplicated(bbox_vector_base_p bboxes) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -127,6 +138,7 @@ cpp11::writable::logicals bbox_duplicated(bbox_vector_base_p bboxes) {
 
 [[cpp11::register]]
 cpp11::writable::integers bbox_any_duplicated(bbox_vector_base_p bboxes) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -135,6 +147,7 @@ cpp11::writable::integers bbox_any_duplicated(bbox_vector_base_p bboxes) {
 
 [[cpp11::register]]
 cpp11::writable::integers bbox_match(bbox_vector_base_p bboxes, bbox_vector_base_p table) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr || table.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -143,6 +156,7 @@ cpp11::writable::integers bbox_match(bbox_vector_base_p bboxes, bbox_vector_base
 
 [[cpp11::register]]
 cpp11::writable::logicals bbox_is_na(bbox_vector_base_p bboxes) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -151,6 +165,7 @@ cpp11::writable::logicals bbox_is_na(bbox_vector_base_p bboxes) {
 
 [[cpp11::register]]
 bool bbox_any_na(bbox_vector_base_p bboxes) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -159,6 +174,7 @@ bool bbox_any_na(bbox_vector_base_p bboxes) {
 
 [[cpp11::register]]
 cpp11::writable::doubles_matrix bbox_to_matrix(bbox_vector_base_p bboxes) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -167,6 +183,7 @@ cpp11::writable::doubles_matrix bbox_to_matrix(bbox_vector_base_p bboxes) {
 
 [[cpp11::register]]
 cpp11::writable::strings bbox_format(bbox_vector_base_p bboxes) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     return {">>>Data structure pointer cleared from memory<<<"};
   }
@@ -175,6 +192,7 @@ cpp11::writable::strings bbox_format(bbox_vector_base_p bboxes) {
 
 [[cpp11::register]]
 cpp11::writable::logicals bbox_is_equal(bbox_vector_base_p bboxes1, bbox_vector_base_p bboxes2) {
+  Profile_scope profile(__func__, bboxes1);
   if (bboxes1.get() == nullptr || bboxes2.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -183,6 +201,7 @@ cpp11::writable::logicals bbox_is_equal(bbox_vector_base_p bboxes1, bbox_vector_
 
 [[cpp11::register]]
 bbox_vector_base_p bbox_plus(bbox_vector_base_p bboxes, bbox_vector_base_p other) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr || other.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -191,6 +210,7 @@ bbox_vector_base_p bbox_plus(bbox_vector_base_p bboxes, bbox_vector_base_p other
 
 [[cpp11::register]]
 bbox_vector_base_p bbox_sum(bbox_vector_base_p bboxes, bool na_rm) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -199,6 +219,7 @@ bbox_vector_base_p bbox_sum(bbox_vector_base_p bboxes, bool na_rm) {
 
 [[cpp11::register]]
 bbox_vector_base_p bbox_cumsum(bbox_vector_base_p bboxes) {
+  Profile_scope profile(__func__, bboxes);
   if (bboxes.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -207,8 +228,38 @@ bbox_vector_base_p bbox_cumsum(bbox_vector_base_p bboxes) {
 
 [[cpp11::register]]
 cpp11::writable::logicals bbox_overlaps(bbox_vector_base_p bboxes1, bbox_vector_base_p bboxes2) {
+  Profile_scope profile(__func__, bboxes1);
   if (bboxes1.get() == nullptr || bboxes2.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
   return bboxes1->overlaps(*bboxes2);
 }
+
+[[cpp11::register]]
+cpp11::writable::doubles bbox_memory_usage(bbox_vector_base_p bboxes) {
+  Profile_scope profile(__func__, bboxes);
+  if (bboxes.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  return bboxes->memory_usage();
+}
+
+[[cpp11::register]]
+cpp11::writable::integers bbox_spatial_order(bbox_vector_base_p bboxes, bool hilbert) {
+  Profile_scope profile(__func__, bboxes);
+  if (bboxes.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  std::vector<int> order;
+  if (bboxes->dimensions() == 2) {
+    order = spatial_order_impl(get_vector_of_bbox<Bbox_2>(*bboxes), hilbert);
+  } else {
+    order = spatial_order_impl(get_vector_of_bbox<Bbox_3>(*bboxes), hilbert);
+  }
+  cpp11::writable::integers result;
+  result.reserve(order.size());
+  for (auto iter = order.begin(); iter != order.end(); ++iter) {
+    result.push_back(*iter + 1);
+  }
+  return result;
+}
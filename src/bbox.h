@@ -11,6 +11,8 @@
 
 #include "cgal_types.h"
 #include "match.h"
+#include "memory_usage.h"
+#include "profile.h"
 
 #include <sstream>
 #include <iomanip>
@@ -92,10 +94,15 @@ public:
   virtual cpp11::writable::logicals overlaps(const bbox_vector_base& other) const = 0;
   virtual cpp11::external_pointer<bbox_vector_base> sum(bool na_rm) const = 0;
   virtual cpp11::external_pointer<bbox_vector_base> cumsum() const = 0;
+  virtual cpp11::writable::doubles memory_usage() const = 0;
 };
 
 typedef cpp11::external_pointer<bbox_vector_base> bbox_vector_base_p;
 
+inline std::string vector_type_name(const bbox_vector_base& bboxes) {
+  return "bbox";
+}
+
 // General constructor
 template<typename T>
 bbox_vector_base_p create_bbox_vector(std::vector<T>& input);
@@ -445,6 +452,8 @@ public:
 
     return create_bbox_vector(result);
   }
+  // Bounding boxes hold doubles and have no construction history, so a serial
+  // scan is used rather than cumulative_scan()
   bbox_vector_base_p cumsum() const {
     std::vector<T> result;
     result.reserve(size());
@@ -465,6 +474,10 @@ public:
 
     return create_bbox_vector(result);
   }
+  cpp11::writable::doubles memory_usage() const {
+    Memory_usage usage(size(), sizeof(T));
+    return usage.as_doubles();
+  }
 };
 
 class bbox2: public bbox_vector<Bbox_2, 2> {
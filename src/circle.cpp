@@ -8,6 +8,7 @@
 
 [[cpp11::register]]
 circle2_p create_circle_2_empty() {
+  Profile_scope profile(__func__);
   std::vector<Circle_2> vec;
   circle2 *result(new circle2(vec));
   return {result};
@@ -15,6 +16,7 @@ circle2_p create_circle_2_empty() {
 
 [[cpp11::register]]
 circle2_p create_circle_2_center_radius(point2_p center, exact_numeric_p r2) {
+  Profile_scope profile(__func__, center);
   std::vector<Circle_2> vec;
   vec.reserve(center->size());
   for (size_t i = 0; i < center->size(); ++i) {
@@ -30,6 +32,7 @@ circle2_p create_circle_2_center_radius(point2_p center, exact_numeric_p r2) {
 }
 [[cpp11::register]]
 circle2_p create_circle_2_3_point(point2_p p, point2_p q, point2_p r) {
+  Profile_scope profile(__func__, p);
   std::vector<Circle_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -50,6 +53,7 @@ circle2_p create_circle_2_3_point(point2_p p, point2_p q, point2_p r) {
 }
 [[cpp11::register]]
 circle2_p create_circle_2_2_point(point2_p p, point2_p q) {
+  Profile_scope profile(__func__, p);
   std::vector<Circle_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -66,6 +70,7 @@ circle2_p create_circle_2_2_point(point2_p p, point2_p q) {
 
 [[cpp11::register]]
 circle3_p create_circle_3_empty() {
+  Profile_scope profile(__func__);
   std::vector<Circle_3> vec;
   circle3 *result(new circle3(vec));
   return {result};
@@ -73,6 +78,7 @@ circle3_p create_circle_3_empty() {
 
 [[cpp11::register]]
 cpp11::external_pointer<circle3> create_circle_3_center_radius_plane(point3_p center, exact_numeric_p r2, plane_p p) {
+  Profile_scope profile(__func__, center);
   std::vector<Circle_3> vec;
   vec.reserve(center->size());
   for (size_t i = 0; i < center->size(); ++i) {
@@ -94,6 +100,7 @@ cpp11::external_pointer<circle3> create_circle_3_center_radius_plane(point3_p ce
 
 [[cpp11::register]]
 cpp11::external_pointer<circle3> create_circle_3_center_radius_vec(point3_p center, exact_numeric_p r2, vector3_p v) {
+  Profile_scope profile(__func__, center);
   std::vector<Circle_3> vec;
   vec.reserve(center->size());
   for (size_t i = 0; i < center->size(); ++i) {
@@ -110,6 +117,7 @@ cpp11::external_pointer<circle3> create_circle_3_center_radius_vec(point3_p cent
 
 [[cpp11::register]]
 cpp11::external_pointer<circle3> create_circle_3_3_point(point3_p p, point3_p q, point3_p r) {
+  Profile_scope profile(__func__, p);
   std::vector<Circle_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -131,6 +139,7 @@ cpp11::external_pointer<circle3> create_circle_3_3_point(point3_p p, point3_p q,
 
 [[cpp11::register]]
 cpp11::external_pointer<circle3> create_circle_3_sphere_sphere(sphere_p s1, sphere_p s2) {
+  Profile_scope profile(__func__, s1);
   std::vector<Circle_3> vec;
   vec.reserve(s1->size());
   for (size_t i = 0; i < s1->size(); ++i) {
@@ -152,6 +161,7 @@ cpp11::external_pointer<circle3> create_circle_3_sphere_sphere(sphere_p s1, sphe
 
 [[cpp11::register]]
 cpp11::external_pointer<circle3> create_circle_3_sphere_plane(sphere_p s, plane_p p) {
+  Profile_scope profile(__func__, s);
   std::vector<Circle_3> vec;
   vec.reserve(s->size());
   for (size_t i = 0; i < s->size(); ++i) {
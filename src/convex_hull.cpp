@@ -0,0 +1,158 @@
+#include "cgal_types.h"
+#include "geometry_vector.h"
+#include "grouping.h"
+
+#include <cpp11/list.hpp>
+#include <cpp11/integers.hpp>
+#include <cpp11/external_pointer.hpp>
+
+#include <map>
+#include <iterator>
+#include <algorithm>
+
+#include <CGAL/property_map.h>
+#include <CGAL/convex_hull_2.h>
+#include <CGAL/Convex_hull_traits_adapter_2.h>
+#include <CGAL/convex_hull_3.h>
+#include <CGAL/Surface_mesh.h>
+
+typedef CGAL::Convex_hull_traits_adapter_2<Kernel, CGAL::Pointer_property_map<Kernel::Point_2>::type> Hull_traits_2;
+typedef CGAL::Surface_mesh<Kernel::Point_3> Hull_mesh;
+
+// Returns the (0-based) indices of the hull vertices of a single group in
+// counterclockwise order
+inline std::vector<int> convex_hull_2_impl(const std::vector<Point_2>& points, const std::vector<int>& group) {
+  std::vector<Kernel::Point_2> group_points;
+  std::vector<int> group_index;
+  group_points.reserve(group.size());
+  group_index.reserve(group.size());
+  for (auto iter = group.begin(); iter != group.end(); ++iter) {
+    if (!points[*iter]) {
+      continue;
+    }
+    group_points.push_back(points[*iter]);
+    group_index.push_back(*iter);
+  }
+
+  std::vector<size_t> local(group_points.size());
+  for (size_t i = 0; i < local.size(); ++i) {
+    local[i] = i;
+  }
+  std::vector<size_t> hull;
+  CGAL::convex_hull_2(local.begin(), local.end(), std::back_inserter(hull), Hull_traits_2(CGAL::make_property_map(group_points)));
+
+  std::vector<int> result;
+  result.reserve(hull.size());
+  for (auto iter = hull.begin(); iter != hull.end(); ++iter) {
+    result.push_back(group_index[*iter]);
+  }
+  return result;
+}
+
+// Returns the (0-based) indices of the hull vertices of a single group and
+// adds the facets of the hull to the facet vector. Hulls of collinear points
+// have no facets and are given by their two extreme points
+inline std::vector<int> convex_hull_3_impl(const std::vector<Point_3>& points, const std::vector<int>& group, std::vector<Triangle_3>& facets) {
+  std::vector<Kernel::Point_3> group_points;
+  std::map<Kernel::Point_3, int> lookup;
+  group_points.reserve(group.size());
+  for (auto iter = group.begin(); iter != group.end(); ++iter) {
+    if (!points[*iter]) {
+      continue;
+    }
+    if (lookup.insert(std::make_pair(points[*iter], *iter)).second) {
+      group_points.push_back(points[*iter]);
+    }
+  }
+
+  std::vector<int> result;
+  if (group_points.size() < 3) {
+    for (auto iter = group_points.begin(); iter != group_points.end(); ++iter) {
+      result.push_back(lookup[*iter]);
+    }
+    return result;
+  }
+  bool collinear = true;
+  for (size_t i = 2; i < group_points.size() && collinear; ++i) {
+    collinear = CGAL::collinear(group_points[0], group_points[1], group_points[i]);
+  }
+  if (collinear) {
+    auto extremes = std::minmax_element(group_points.begin(), group_points.end());
+    result.push_back(lookup[*extremes.first]);
+    result.push_back(lookup[*extremes.second]);
+    return result;
+  }
+
+  Hull_mesh mesh;
+  CGAL::convex_hull_3(group_points.begin(), group_points.end(), mesh);
+
+  result.reserve(mesh.number_of_vertices());
+  for (auto v : mesh.vertices()) {
+    result.push_back(lookup[mesh.point(v)]);
+  }
+  // Hulls of coplanar points consists of a single polygonal face so faces are
+  // triangulated as a fan
+  for (auto f : mesh.faces()) {
+    auto first = mesh.halfedge(f);
+    auto h = mesh.next(first);
+    while (mesh.target(h) != mesh.source(first)) {
+      facets.emplace_back(
+        mesh.point(mesh.source(first)),
+        mesh.point(mesh.source(h)),
+        mesh.point(mesh.target(h))
+      );
+      h = mesh.next(h);
+    }
+  }
+  return result;
+}
+
+[[cpp11::register]]
+cpp11::writable::list geometry_convex_hull(geometry_vector_base_p points, cpp11::integers group) {
+  Profile_scope profile(__func__, points);
+  if (points.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  if (points->geometry_type() != POINT) {
+    cpp11::stop("Convex hulls can only be calculated for points");
+  }
+  std::vector< std::vector<int> > groups = split_groups(group, points->size());
+
+  cpp11::writable::integers index;
+  cpp11::writable::integers index_group;
+  cpp11::writable::list result;
+
+  if (points->dimensions() == 2) {
+    std::vector<Point_2> vec = get_vector_of_geo<Point_2>(*points);
+    for (size_t i = 0; i < groups.size(); ++i) {
+      std::vector<int> hull = convex_hull_2_impl(vec, groups[i]);
+      for (auto iter = hull.begin(); iter != hull.end(); ++iter) {
+        index.push_back(*iter + 1);
+        index_group.push_back(i + 1);
+      }
+    }
+    result.push_back(index);
+    result.push_back(index_group);
+  } else {
+    std::vector<Point_3> vec = get_vector_of_geo<Point_3>(*points);
+    std::vector<Triangle_3> facets;
+    cpp11::writable::integers facet_group;
+    for (size_t i = 0; i < groups.size(); ++i) {
+      size_t n_facets = facets.size();
+      std::vector<int> hull = convex_hull_3_impl(vec, groups[i], facets);
+      for (auto iter = hull.begin(); iter != hull.end(); ++iter) {
+        index.push_back(*iter + 1);
+        index_group.push_back(i + 1);
+      }
+      for (size_t j = n_facets; j < facets.size(); ++j) {
+        facet_group.push_back(i + 1);
+      }
+    }
+    result.push_back(index);
+    result.push_back(index_group);
+    result.push_back(create_geometry_vector(facets));
+    result.push_back(facet_group);
+  }
+
+  return result;
+}
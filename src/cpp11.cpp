@@ -151,6 +151,20 @@ extern "C" SEXP _euclid_bbox_overlaps(SEXP bboxes1, SEXP bboxes2) {
     return cpp11::as_sexp(bbox_overlaps(cpp11::as_cpp<cpp11::decay_t<bbox_vector_base_p>>(bboxes1), cpp11::as_cpp<cpp11::decay_t<bbox_vector_base_p>>(bboxes2)));
   END_CPP11
 }
+// bbox.cpp
+cpp11::writable::doubles bbox_memory_usage(bbox_vector_base_p bboxes);
+extern "C" SEXP _euclid_bbox_memory_usage(SEXP bboxes) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(bbox_memory_usage(cpp11::as_cpp<cpp11::decay_t<bbox_vector_base_p>>(bboxes)));
+  END_CPP11
+}
+// bbox.cpp
+cpp11::writable::integers bbox_spatial_order(bbox_vector_base_p bboxes, bool hilbert);
+extern "C" SEXP _euclid_bbox_spatial_order(SEXP bboxes, SEXP hilbert) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(bbox_spatial_order(cpp11::as_cpp<cpp11::decay_t<bbox_vector_base_p>>(bboxes), cpp11::as_cpp<cpp11::decay_t<bool>>(hilbert)));
+  END_CPP11
+}
 // circle.cpp
 circle2_p create_circle_2_empty();
 extern "C" SEXP _euclid_create_circle_2_empty() {
@@ -221,6 +235,13 @@ extern "C" SEXP _euclid_create_circle_3_sphere_plane(SEXP s, SEXP p) {
     return cpp11::as_sexp(create_circle_3_sphere_plane(cpp11::as_cpp<cpp11::decay_t<sphere_p>>(s), cpp11::as_cpp<cpp11::decay_t<plane_p>>(p)));
   END_CPP11
 }
+// convex_hull.cpp
+cpp11::writable::list geometry_convex_hull(geometry_vector_base_p points, cpp11::integers group);
+extern "C" SEXP _euclid_geometry_convex_hull(SEXP points, SEXP group) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_convex_hull(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(points), cpp11::as_cpp<cpp11::decay_t<cpp11::integers>>(group)));
+  END_CPP11
+}
 // direction.cpp
 direction2_p create_direction_2_empty();
 extern "C" SEXP _euclid_create_direction_2_empty() {
@@ -396,6 +417,20 @@ extern "C" SEXP _euclid_geometry_distance_matrix(SEXP geo1, SEXP geo2) {
     return cpp11::as_sexp(geometry_distance_matrix(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geo1), cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geo2)));
   END_CPP11
 }
+// distance.cpp
+exact_numeric_p geometry_hausdorff_distance(geometry_vector_base_p geo1, geometry_vector_base_p geo2, bool directed);
+extern "C" SEXP _euclid_geometry_hausdorff_distance(SEXP geo1, SEXP geo2, SEXP directed) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_hausdorff_distance(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geo1), cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geo2), cpp11::as_cpp<cpp11::decay_t<bool>>(directed)));
+  END_CPP11
+}
+// distance.cpp
+exact_numeric_p geometry_chamfer_distance(geometry_vector_base_p geo1, geometry_vector_base_p geo2, bool directed);
+extern "C" SEXP _euclid_geometry_chamfer_distance(SEXP geo1, SEXP geo2, SEXP directed) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_chamfer_distance(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geo1), cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geo2), cpp11::as_cpp<cpp11::decay_t<bool>>(directed)));
+  END_CPP11
+}
 // exact_numeric.cpp
 exact_numeric_p create_exact_numeric(cpp11::doubles numeric);
 extern "C" SEXP _euclid_create_exact_numeric(SEXP numeric) {
@@ -551,6 +586,42 @@ extern "C" SEXP _euclid_exact_numeric_abs(SEXP ex_n) {
   END_CPP11
 }
 // exact_numeric.cpp
+exact_numeric_p exact_numeric_approximate(exact_numeric_p ex_n);
+extern "C" SEXP _euclid_exact_numeric_approximate(SEXP ex_n) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(exact_numeric_approximate(cpp11::as_cpp<cpp11::decay_t<exact_numeric_p>>(ex_n)));
+  END_CPP11
+}
+// exact_numeric.cpp
+void exact_numeric_materialize(exact_numeric_p ex_n);
+extern "C" SEXP _euclid_exact_numeric_materialize(SEXP ex_n) {
+  BEGIN_CPP11
+    exact_numeric_materialize(cpp11::as_cpp<cpp11::decay_t<exact_numeric_p>>(ex_n));
+    return R_NilValue;
+  END_CPP11
+}
+// exact_numeric.cpp
+cpp11::writable::doubles exact_numeric_memory_usage(exact_numeric_p ex_n);
+extern "C" SEXP _euclid_exact_numeric_memory_usage(SEXP ex_n) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(exact_numeric_memory_usage(cpp11::as_cpp<cpp11::decay_t<exact_numeric_p>>(ex_n)));
+  END_CPP11
+}
+// exact_numeric.cpp
+cpp11::writable::integers_matrix exact_numeric_bit_length(exact_numeric_p ex_n);
+extern "C" SEXP _euclid_exact_numeric_bit_length(SEXP ex_n) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(exact_numeric_bit_length(cpp11::as_cpp<cpp11::decay_t<exact_numeric_p>>(ex_n)));
+  END_CPP11
+}
+// exact_numeric.cpp
+int exact_numeric_max_bit_length(exact_numeric_p ex_n);
+extern "C" SEXP _euclid_exact_numeric_max_bit_length(SEXP ex_n) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(exact_numeric_max_bit_length(cpp11::as_cpp<cpp11::decay_t<exact_numeric_p>>(ex_n)));
+  END_CPP11
+}
+// exact_numeric.cpp
 cpp11::writable::integers exact_numeric_sign(exact_numeric_p ex_n);
 extern "C" SEXP _euclid_exact_numeric_sign(SEXP ex_n) {
   BEGIN_CPP11
@@ -627,6 +698,28 @@ extern "C" SEXP _euclid_exact_numeric_max(SEXP ex_n, SEXP na_rm) {
     return cpp11::as_sexp(exact_numeric_max(cpp11::as_cpp<cpp11::decay_t<exact_numeric_p>>(ex_n), cpp11::as_cpp<cpp11::decay_t<bool>>(na_rm)));
   END_CPP11
 }
+// filter_stats.cpp
+bool filter_stats_enable(bool enable);
+extern "C" SEXP _euclid_filter_stats_enable(SEXP enable) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(filter_stats_enable(cpp11::as_cpp<cpp11::decay_t<bool>>(enable)));
+  END_CPP11
+}
+// filter_stats.cpp
+void filter_stats_reset();
+extern "C" SEXP _euclid_filter_stats_reset() {
+  BEGIN_CPP11
+    filter_stats_reset();
+    return R_NilValue;
+  END_CPP11
+}
+// filter_stats.cpp
+cpp11::writable::list filter_stats_get();
+extern "C" SEXP _euclid_filter_stats_get() {
+  BEGIN_CPP11
+    return cpp11::as_sexp(filter_stats_get());
+  END_CPP11
+}
 // geometry_common.cpp
 cpp11::writable::strings geometry_primitive_type(geometry_vector_base_p geometries);
 extern "C" SEXP _euclid_geometry_primitive_type(SEXP geometries) {
@@ -781,6 +874,49 @@ extern "C" SEXP _euclid_geometry_bbox(SEXP geometries) {
     return cpp11::as_sexp(geometry_bbox(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geometries)));
   END_CPP11
 }
+// geometry_common.cpp
+geometry_vector_base_p geometry_approximate(geometry_vector_base_p geometries);
+extern "C" SEXP _euclid_geometry_approximate(SEXP geometries) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_approximate(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geometries)));
+  END_CPP11
+}
+// geometry_common.cpp
+void geometry_materialize(geometry_vector_base_p geometries);
+extern "C" SEXP _euclid_geometry_materialize(SEXP geometries) {
+  BEGIN_CPP11
+    geometry_materialize(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geometries));
+    return R_NilValue;
+  END_CPP11
+}
+// geometry_common.cpp
+cpp11::writable::doubles geometry_memory_usage(geometry_vector_base_p geometries);
+extern "C" SEXP _euclid_geometry_memory_usage(SEXP geometries) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_memory_usage(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geometries)));
+  END_CPP11
+}
+// geometry_common.cpp
+cpp11::writable::integers_matrix geometry_bit_length(geometry_vector_base_p geometries);
+extern "C" SEXP _euclid_geometry_bit_length(SEXP geometries) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_bit_length(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geometries)));
+  END_CPP11
+}
+// geometry_common.cpp
+int geometry_max_bit_length(geometry_vector_base_p geometries);
+extern "C" SEXP _euclid_geometry_max_bit_length(SEXP geometries) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_max_bit_length(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geometries)));
+  END_CPP11
+}
+// geometry_common.cpp
+int set_materialize_depth(int depth);
+extern "C" SEXP _euclid_set_materialize_depth(SEXP depth) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(set_materialize_depth(cpp11::as_cpp<cpp11::decay_t<int>>(depth)));
+  END_CPP11
+}
 // geometry_measures.cpp
 cpp11::writable::doubles geometry_approx_length(geometry_vector_base_p geometries);
 extern "C" SEXP _euclid_geometry_approx_length(SEXP geometries) {
@@ -886,6 +1022,62 @@ extern "C" SEXP _euclid_geometry_normal(SEXP geometries) {
     return cpp11::as_sexp(geometry_normal(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geometries)));
   END_CPP11
 }
+// group_summary.cpp
+geometry_vector_base_p geometry_group_sum(geometry_vector_base_p geometries, cpp11::integers group, bool na_rm);
+extern "C" SEXP _euclid_geometry_group_sum(SEXP geometries, SEXP group, SEXP na_rm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_group_sum(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geometries), cpp11::as_cpp<cpp11::decay_t<cpp11::integers>>(group), cpp11::as_cpp<cpp11::decay_t<bool>>(na_rm)));
+  END_CPP11
+}
+// group_summary.cpp
+geometry_vector_base_p geometry_group_min(geometry_vector_base_p geometries, cpp11::integers group, bool na_rm);
+extern "C" SEXP _euclid_geometry_group_min(SEXP geometries, SEXP group, SEXP na_rm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_group_min(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geometries), cpp11::as_cpp<cpp11::decay_t<cpp11::integers>>(group), cpp11::as_cpp<cpp11::decay_t<bool>>(na_rm)));
+  END_CPP11
+}
+// group_summary.cpp
+geometry_vector_base_p geometry_group_max(geometry_vector_base_p geometries, cpp11::integers group, bool na_rm);
+extern "C" SEXP _euclid_geometry_group_max(SEXP geometries, SEXP group, SEXP na_rm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_group_max(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geometries), cpp11::as_cpp<cpp11::decay_t<cpp11::integers>>(group), cpp11::as_cpp<cpp11::decay_t<bool>>(na_rm)));
+  END_CPP11
+}
+// group_summary.cpp
+geometry_vector_base_p geometry_group_centroid(geometry_vector_base_p geometries, cpp11::integers group, bool na_rm);
+extern "C" SEXP _euclid_geometry_group_centroid(SEXP geometries, SEXP group, SEXP na_rm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_group_centroid(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geometries), cpp11::as_cpp<cpp11::decay_t<cpp11::integers>>(group), cpp11::as_cpp<cpp11::decay_t<bool>>(na_rm)));
+  END_CPP11
+}
+// group_summary.cpp
+exact_numeric_p exact_numeric_group_sum(exact_numeric_p ex_n, cpp11::integers group, bool na_rm);
+extern "C" SEXP _euclid_exact_numeric_group_sum(SEXP ex_n, SEXP group, SEXP na_rm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(exact_numeric_group_sum(cpp11::as_cpp<cpp11::decay_t<exact_numeric_p>>(ex_n), cpp11::as_cpp<cpp11::decay_t<cpp11::integers>>(group), cpp11::as_cpp<cpp11::decay_t<bool>>(na_rm)));
+  END_CPP11
+}
+// group_summary.cpp
+exact_numeric_p exact_numeric_group_min(exact_numeric_p ex_n, cpp11::integers group, bool na_rm);
+extern "C" SEXP _euclid_exact_numeric_group_min(SEXP ex_n, SEXP group, SEXP na_rm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(exact_numeric_group_min(cpp11::as_cpp<cpp11::decay_t<exact_numeric_p>>(ex_n), cpp11::as_cpp<cpp11::decay_t<cpp11::integers>>(group), cpp11::as_cpp<cpp11::decay_t<bool>>(na_rm)));
+  END_CPP11
+}
+// group_summary.cpp
+exact_numeric_p exact_numeric_group_max(exact_numeric_p ex_n, cpp11::integers group, bool na_rm);
+extern "C" SEXP _euclid_exact_numeric_group_max(SEXP ex_n, SEXP group, SEXP na_rm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(exact_numeric_group_max(cpp11::as_cpp<cpp11::decay_t<exact_numeric_p>>(ex_n), cpp11::as_cpp<cpp11::decay_t<cpp11::integers>>(group), cpp11::as_cpp<cpp11::decay_t<bool>>(na_rm)));
+  END_CPP11
+}
+// group_summary.cpp
+bbox_vector_base_p bbox_group_sum(bbox_vector_base_p bboxes, cpp11::integers group, bool na_rm);
+extern "C" SEXP _euclid_bbox_group_sum(SEXP bboxes, SEXP group, SEXP na_rm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(bbox_group_sum(cpp11::as_cpp<cpp11::decay_t<bbox_vector_base_p>>(bboxes), cpp11::as_cpp<cpp11::decay_t<cpp11::integers>>(group), cpp11::as_cpp<cpp11::decay_t<bool>>(na_rm)));
+  END_CPP11
+}
 // intersection.cpp
 cpp11::writable::list geometry_intersection(geometry_vector_base_p geo1, geometry_vector_base_p geo2);
 extern "C" SEXP _euclid_geometry_intersection(SEXP geo1, SEXP geo2) {
@@ -1110,6 +1302,13 @@ extern "C" SEXP _euclid_geometry_radical_geometry(SEXP geo1, SEXP geo2) {
     return cpp11::as_sexp(geometry_radical_geometry(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geo1), cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geo2)));
   END_CPP11
 }
+// min_enclosing.cpp
+geometry_vector_base_p geometry_min_enclosing(geometry_vector_base_p points, cpp11::integers group);
+extern "C" SEXP _euclid_geometry_min_enclosing(SEXP points, SEXP group) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_min_enclosing(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(points), cpp11::as_cpp<cpp11::decay_t<cpp11::integers>>(group)));
+  END_CPP11
+}
 // plane.cpp
 plane_p create_plane_empty();
 extern "C" SEXP _euclid_create_plane_empty() {
@@ -1481,6 +1680,70 @@ extern "C" SEXP _euclid_point_turns(SEXP x) {
     return cpp11::as_sexp(point_turns(cpp11::as_cpp<cpp11::decay_t<point2_p>>(x)));
   END_CPP11
 }
+// products.cpp
+exact_numeric_p exact_numeric_sum_of_products(exact_numeric_p x, exact_numeric_p y, bool na_rm);
+extern "C" SEXP _euclid_exact_numeric_sum_of_products(SEXP x, SEXP y, SEXP na_rm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(exact_numeric_sum_of_products(cpp11::as_cpp<cpp11::decay_t<exact_numeric_p>>(x), cpp11::as_cpp<cpp11::decay_t<exact_numeric_p>>(y), cpp11::as_cpp<cpp11::decay_t<bool>>(na_rm)));
+  END_CPP11
+}
+// products.cpp
+exact_numeric_p vector_2_sum_of_products(vector2_p x, vector2_p y, bool na_rm);
+extern "C" SEXP _euclid_vector_2_sum_of_products(SEXP x, SEXP y, SEXP na_rm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(vector_2_sum_of_products(cpp11::as_cpp<cpp11::decay_t<vector2_p>>(x), cpp11::as_cpp<cpp11::decay_t<vector2_p>>(y), cpp11::as_cpp<cpp11::decay_t<bool>>(na_rm)));
+  END_CPP11
+}
+// products.cpp
+exact_numeric_p vector_3_sum_of_products(vector3_p x, vector3_p y, bool na_rm);
+extern "C" SEXP _euclid_vector_3_sum_of_products(SEXP x, SEXP y, SEXP na_rm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(vector_3_sum_of_products(cpp11::as_cpp<cpp11::decay_t<vector3_p>>(x), cpp11::as_cpp<cpp11::decay_t<vector3_p>>(y), cpp11::as_cpp<cpp11::decay_t<bool>>(na_rm)));
+  END_CPP11
+}
+// products.cpp
+exact_numeric_p vector_2_determinant(vector2_p u, vector2_p v);
+extern "C" SEXP _euclid_vector_2_determinant(SEXP u, SEXP v) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(vector_2_determinant(cpp11::as_cpp<cpp11::decay_t<vector2_p>>(u), cpp11::as_cpp<cpp11::decay_t<vector2_p>>(v)));
+  END_CPP11
+}
+// products.cpp
+exact_numeric_p vector_3_determinant(vector3_p u, vector3_p v, vector3_p w);
+extern "C" SEXP _euclid_vector_3_determinant(SEXP u, SEXP v, SEXP w) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(vector_3_determinant(cpp11::as_cpp<cpp11::decay_t<vector3_p>>(u), cpp11::as_cpp<cpp11::decay_t<vector3_p>>(v), cpp11::as_cpp<cpp11::decay_t<vector3_p>>(w)));
+  END_CPP11
+}
+// products.cpp
+exact_numeric_p exact_numeric_determinant(cpp11::list_of<exact_numeric_p> entries);
+extern "C" SEXP _euclid_exact_numeric_determinant(SEXP entries) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(exact_numeric_determinant(cpp11::as_cpp<cpp11::decay_t<cpp11::list_of<exact_numeric_p>>>(entries)));
+  END_CPP11
+}
+// profile.cpp
+bool profile_enable(bool enable);
+extern "C" SEXP _euclid_profile_enable(SEXP enable) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(profile_enable(cpp11::as_cpp<cpp11::decay_t<bool>>(enable)));
+  END_CPP11
+}
+// profile.cpp
+void profile_reset();
+extern "C" SEXP _euclid_profile_reset() {
+  BEGIN_CPP11
+    profile_reset();
+    return R_NilValue;
+  END_CPP11
+}
+// profile.cpp
+cpp11::writable::list profile_get();
+extern "C" SEXP _euclid_profile_get() {
+  BEGIN_CPP11
+    return cpp11::as_sexp(profile_get());
+  END_CPP11
+}
 // ray.cpp
 ray2_p create_ray_2_empty();
 extern "C" SEXP _euclid_create_ray_2_empty() {
@@ -1621,6 +1884,34 @@ extern "C" SEXP _euclid_segment_3_negate(SEXP x) {
     return cpp11::as_sexp(segment_3_negate(cpp11::as_cpp<cpp11::decay_t<segment3_p>>(x)));
   END_CPP11
 }
+// self_intersection.cpp
+cpp11::writable::integers_matrix geometry_self_intersections(geometry_vector_base_p triangles);
+extern "C" SEXP _euclid_geometry_self_intersections(SEXP triangles) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_self_intersections(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(triangles)));
+  END_CPP11
+}
+// slice.cpp
+cpp11::writable::list geometry_slice_triangles(geometry_vector_base_p triangles, geometry_vector_base_p planes);
+extern "C" SEXP _euclid_geometry_slice_triangles(SEXP triangles, SEXP planes) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_slice_triangles(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(triangles), cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(planes)));
+  END_CPP11
+}
+// snap_rounding.cpp
+double set_snap_grid(double grid);
+extern "C" SEXP _euclid_set_snap_grid(SEXP grid) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(set_snap_grid(cpp11::as_cpp<cpp11::decay_t<double>>(grid)));
+  END_CPP11
+}
+// snap_rounding.cpp
+cpp11::writable::list geometry_snap_round(geometry_vector_base_p segments, double pixel_size, bool iterated);
+extern "C" SEXP _euclid_geometry_snap_round(SEXP segments, SEXP pixel_size, SEXP iterated) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_snap_round(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(segments), cpp11::as_cpp<cpp11::decay_t<double>>(pixel_size), cpp11::as_cpp<cpp11::decay_t<bool>>(iterated)));
+  END_CPP11
+}
 // sphere.cpp
 sphere_p create_sphere_empty();
 extern "C" SEXP _euclid_create_sphere_empty() {
@@ -1887,6 +2178,21 @@ extern "C" SEXP _euclid_transform_cumprod(SEXP transforms) {
     return cpp11::as_sexp(transform_cumprod(cpp11::as_cpp<cpp11::decay_t<transform_vector_base_p>>(transforms)));
   END_CPP11
 }
+// transform.cpp
+void transform_materialize(transform_vector_base_p transforms);
+extern "C" SEXP _euclid_transform_materialize(SEXP transforms) {
+  BEGIN_CPP11
+    transform_materialize(cpp11::as_cpp<cpp11::decay_t<transform_vector_base_p>>(transforms));
+    return R_NilValue;
+  END_CPP11
+}
+// transform.cpp
+cpp11::writable::doubles transform_memory_usage(transform_vector_base_p transforms);
+extern "C" SEXP _euclid_transform_memory_usage(SEXP transforms) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(transform_memory_usage(cpp11::as_cpp<cpp11::decay_t<transform_vector_base_p>>(transforms)));
+  END_CPP11
+}
 // triangle.cpp
 triangle2_p create_triangle_2_empty();
 extern "C" SEXP _euclid_create_triangle_2_empty() {
@@ -1915,6 +2221,27 @@ extern "C" SEXP _euclid_create_triangle_3_3points(SEXP p, SEXP q, SEXP r) {
     return cpp11::as_sexp(create_triangle_3_3points(cpp11::as_cpp<cpp11::decay_t<point3_p>>(p), cpp11::as_cpp<cpp11::decay_t<point3_p>>(q), cpp11::as_cpp<cpp11::decay_t<point3_p>>(r)));
   END_CPP11
 }
+// triangulation.cpp
+cpp11::writable::list geometry_delaunay_triangulation(geometry_vector_base_p points);
+extern "C" SEXP _euclid_geometry_delaunay_triangulation(SEXP points) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_delaunay_triangulation(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(points)));
+  END_CPP11
+}
+// triangulation.cpp
+cpp11::writable::list geometry_regular_triangulation(geometry_vector_base_p points);
+extern "C" SEXP _euclid_geometry_regular_triangulation(SEXP points) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_regular_triangulation(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(points)));
+  END_CPP11
+}
+// union_measure.cpp
+exact_numeric_p geometry_union_measure(geometry_vector_base_p geometries, bool overlap, bool na_rm);
+extern "C" SEXP _euclid_geometry_union_measure(SEXP geometries, SEXP overlap, SEXP na_rm) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(geometry_union_measure(cpp11::as_cpp<cpp11::decay_t<geometry_vector_base_p>>(geometries), cpp11::as_cpp<cpp11::decay_t<bool>>(overlap), cpp11::as_cpp<cpp11::decay_t<bool>>(na_rm)));
+  END_CPP11
+}
 // vector.cpp
 vector2_p create_vector_2_empty();
 extern "C" SEXP _euclid_create_vector_2_empty() {
@@ -2137,12 +2464,15 @@ extern SEXP _euclid_bbox_cumsum(SEXP);
 extern SEXP _euclid_bbox_dimension(SEXP);
 extern SEXP _euclid_bbox_duplicated(SEXP);
 extern SEXP _euclid_bbox_format(SEXP);
+extern SEXP _euclid_bbox_group_sum(SEXP, SEXP, SEXP);
 extern SEXP _euclid_bbox_is_equal(SEXP, SEXP);
 extern SEXP _euclid_bbox_is_na(SEXP);
 extern SEXP _euclid_bbox_length(SEXP);
 extern SEXP _euclid_bbox_match(SEXP, SEXP);
+extern SEXP _euclid_bbox_memory_usage(SEXP);
 extern SEXP _euclid_bbox_overlaps(SEXP, SEXP);
 extern SEXP _euclid_bbox_plus(SEXP, SEXP);
+extern SEXP _euclid_bbox_spatial_order(SEXP, SEXP);
 extern SEXP _euclid_bbox_subset(SEXP, SEXP);
 extern SEXP _euclid_bbox_sum(SEXP, SEXP);
 extern SEXP _euclid_bbox_to_matrix(SEXP);
@@ -2282,22 +2612,31 @@ extern SEXP _euclid_direction_3_negate(SEXP);
 extern SEXP _euclid_exact_numeric_abs(SEXP);
 extern SEXP _euclid_exact_numeric_any_duplicated(SEXP);
 extern SEXP _euclid_exact_numeric_any_na(SEXP);
+extern SEXP _euclid_exact_numeric_approximate(SEXP);
 extern SEXP _euclid_exact_numeric_assign(SEXP, SEXP, SEXP);
+extern SEXP _euclid_exact_numeric_bit_length(SEXP);
 extern SEXP _euclid_exact_numeric_combine(SEXP, SEXP);
 extern SEXP _euclid_exact_numeric_cummax(SEXP);
 extern SEXP _euclid_exact_numeric_cummin(SEXP);
 extern SEXP _euclid_exact_numeric_cumprod(SEXP);
 extern SEXP _euclid_exact_numeric_cumsum(SEXP);
+extern SEXP _euclid_exact_numeric_determinant(SEXP);
 extern SEXP _euclid_exact_numeric_diff(SEXP, SEXP);
 extern SEXP _euclid_exact_numeric_divided(SEXP, SEXP);
 extern SEXP _euclid_exact_numeric_duplicated(SEXP);
 extern SEXP _euclid_exact_numeric_greater(SEXP, SEXP);
+extern SEXP _euclid_exact_numeric_group_max(SEXP, SEXP, SEXP);
+extern SEXP _euclid_exact_numeric_group_min(SEXP, SEXP, SEXP);
+extern SEXP _euclid_exact_numeric_group_sum(SEXP, SEXP, SEXP);
 extern SEXP _euclid_exact_numeric_is_equal(SEXP, SEXP);
 extern SEXP _euclid_exact_numeric_is_na(SEXP);
 extern SEXP _euclid_exact_numeric_length(SEXP);
 extern SEXP _euclid_exact_numeric_less(SEXP, SEXP);
 extern SEXP _euclid_exact_numeric_match(SEXP, SEXP);
+extern SEXP _euclid_exact_numeric_materialize(SEXP);
 extern SEXP _euclid_exact_numeric_max(SEXP, SEXP);
+extern SEXP _euclid_exact_numeric_max_bit_length(SEXP);
+extern SEXP _euclid_exact_numeric_memory_usage(SEXP);
 extern SEXP _euclid_exact_numeric_min(SEXP, SEXP);
 extern SEXP _euclid_exact_numeric_minus(SEXP, SEXP);
 extern SEXP _euclid_exact_numeric_plus(SEXP, SEXP);
@@ -2307,41 +2646,55 @@ extern SEXP _euclid_exact_numeric_sign(SEXP);
 extern SEXP _euclid_exact_numeric_sort(SEXP, SEXP, SEXP);
 extern SEXP _euclid_exact_numeric_subset(SEXP, SEXP);
 extern SEXP _euclid_exact_numeric_sum(SEXP, SEXP);
+extern SEXP _euclid_exact_numeric_sum_of_products(SEXP, SEXP, SEXP);
 extern SEXP _euclid_exact_numeric_times(SEXP, SEXP);
 extern SEXP _euclid_exact_numeric_to_numeric(SEXP);
 extern SEXP _euclid_exact_numeric_uni_minus(SEXP);
 extern SEXP _euclid_exact_numeric_unique(SEXP);
+extern SEXP _euclid_filter_stats_enable(SEXP);
+extern SEXP _euclid_filter_stats_get();
+extern SEXP _euclid_filter_stats_reset();
 extern SEXP _euclid_geometry_any_duplicated(SEXP);
 extern SEXP _euclid_geometry_any_na(SEXP);
 extern SEXP _euclid_geometry_approx_area(SEXP);
 extern SEXP _euclid_geometry_approx_length(SEXP);
 extern SEXP _euclid_geometry_approx_volume(SEXP);
+extern SEXP _euclid_geometry_approximate(SEXP);
 extern SEXP _euclid_geometry_assign(SEXP, SEXP, SEXP);
 extern SEXP _euclid_geometry_barycenter_2(SEXP, SEXP);
 extern SEXP _euclid_geometry_barycenter_3(SEXP, SEXP, SEXP);
 extern SEXP _euclid_geometry_barycenter_4(SEXP, SEXP, SEXP, SEXP);
 extern SEXP _euclid_geometry_bbox(SEXP);
 extern SEXP _euclid_geometry_bisector(SEXP, SEXP);
+extern SEXP _euclid_geometry_bit_length(SEXP);
 extern SEXP _euclid_geometry_cardinality(SEXP);
 extern SEXP _euclid_geometry_centroid_1(SEXP);
 extern SEXP _euclid_geometry_centroid_3(SEXP, SEXP, SEXP);
 extern SEXP _euclid_geometry_centroid_4(SEXP, SEXP, SEXP, SEXP);
+extern SEXP _euclid_geometry_chamfer_distance(SEXP, SEXP, SEXP);
 extern SEXP _euclid_geometry_combine(SEXP, SEXP);
 extern SEXP _euclid_geometry_constant_in(SEXP, SEXP);
+extern SEXP _euclid_geometry_convex_hull(SEXP, SEXP);
 extern SEXP _euclid_geometry_copy(SEXP);
 extern SEXP _euclid_geometry_definition(SEXP, SEXP, SEXP);
 extern SEXP _euclid_geometry_definition_names(SEXP);
+extern SEXP _euclid_geometry_delaunay_triangulation(SEXP);
 extern SEXP _euclid_geometry_dimension(SEXP);
 extern SEXP _euclid_geometry_distance_matrix(SEXP, SEXP);
 extern SEXP _euclid_geometry_do_intersect(SEXP, SEXP);
 extern SEXP _euclid_geometry_duplicated(SEXP);
 extern SEXP _euclid_geometry_equidistant_line(SEXP, SEXP, SEXP);
 extern SEXP _euclid_geometry_format(SEXP);
+extern SEXP _euclid_geometry_group_centroid(SEXP, SEXP, SEXP);
+extern SEXP _euclid_geometry_group_max(SEXP, SEXP, SEXP);
+extern SEXP _euclid_geometry_group_min(SEXP, SEXP, SEXP);
+extern SEXP _euclid_geometry_group_sum(SEXP, SEXP, SEXP);
 extern SEXP _euclid_geometry_has_point_inside(SEXP, SEXP);
 extern SEXP _euclid_geometry_has_point_on(SEXP, SEXP);
 extern SEXP _euclid_geometry_has_point_on_negative(SEXP, SEXP);
 extern SEXP _euclid_geometry_has_point_on_positive(SEXP, SEXP);
 extern SEXP _euclid_geometry_has_point_outside(SEXP, SEXP);
+extern SEXP _euclid_geometry_hausdorff_distance(SEXP, SEXP, SEXP);
 extern SEXP _euclid_geometry_intersection(SEXP, SEXP);
 extern SEXP _euclid_geometry_is_degenerate(SEXP);
 extern SEXP _euclid_geometry_is_equal(SEXP, SEXP);
@@ -2349,16 +2702,25 @@ extern SEXP _euclid_geometry_is_na(SEXP);
 extern SEXP _euclid_geometry_length(SEXP);
 extern SEXP _euclid_geometry_map_to_plane(SEXP, SEXP);
 extern SEXP _euclid_geometry_match(SEXP, SEXP);
+extern SEXP _euclid_geometry_materialize(SEXP);
+extern SEXP _euclid_geometry_max_bit_length(SEXP);
+extern SEXP _euclid_geometry_memory_usage(SEXP);
+extern SEXP _euclid_geometry_min_enclosing(SEXP, SEXP);
 extern SEXP _euclid_geometry_normal(SEXP);
 extern SEXP _euclid_geometry_parallel(SEXP, SEXP);
 extern SEXP _euclid_geometry_primitive_type(SEXP);
 extern SEXP _euclid_geometry_project_to_line(SEXP, SEXP);
 extern SEXP _euclid_geometry_project_to_plane(SEXP, SEXP);
 extern SEXP _euclid_geometry_radical_geometry(SEXP, SEXP);
+extern SEXP _euclid_geometry_regular_triangulation(SEXP);
+extern SEXP _euclid_geometry_self_intersections(SEXP);
+extern SEXP _euclid_geometry_slice_triangles(SEXP, SEXP);
+extern SEXP _euclid_geometry_snap_round(SEXP, SEXP, SEXP);
 extern SEXP _euclid_geometry_squared_distance(SEXP, SEXP);
 extern SEXP _euclid_geometry_subset(SEXP, SEXP);
 extern SEXP _euclid_geometry_to_matrix(SEXP);
 extern SEXP _euclid_geometry_transform(SEXP, SEXP);
+extern SEXP _euclid_geometry_union_measure(SEXP, SEXP, SEXP);
 extern SEXP _euclid_geometry_unique(SEXP);
 extern SEXP _euclid_geometry_vertex(SEXP, SEXP);
 extern SEXP _euclid_point_2_add_vector(SEXP, SEXP);
@@ -2390,10 +2752,15 @@ extern SEXP _euclid_point_ordered_along(SEXP);
 extern SEXP _euclid_point_turns(SEXP);
 extern SEXP _euclid_point_turns_left(SEXP, SEXP, SEXP);
 extern SEXP _euclid_point_turns_right(SEXP, SEXP, SEXP);
+extern SEXP _euclid_profile_enable(SEXP);
+extern SEXP _euclid_profile_get();
+extern SEXP _euclid_profile_reset();
 extern SEXP _euclid_ray_2_negate(SEXP);
 extern SEXP _euclid_ray_3_negate(SEXP);
 extern SEXP _euclid_segment_2_negate(SEXP);
 extern SEXP _euclid_segment_3_negate(SEXP);
+extern SEXP _euclid_set_materialize_depth(SEXP);
+extern SEXP _euclid_set_snap_grid(SEXP);
 extern SEXP _euclid_transform_any_duplicated(SEXP);
 extern SEXP _euclid_transform_any_na(SEXP);
 extern SEXP _euclid_transform_assign(SEXP, SEXP, SEXP);
@@ -2410,6 +2777,8 @@ extern SEXP _euclid_transform_is_na(SEXP);
 extern SEXP _euclid_transform_is_reflecting(SEXP);
 extern SEXP _euclid_transform_length(SEXP);
 extern SEXP _euclid_transform_match(SEXP, SEXP);
+extern SEXP _euclid_transform_materialize(SEXP);
+extern SEXP _euclid_transform_memory_usage(SEXP);
 extern SEXP _euclid_transform_multiply(SEXP, SEXP);
 extern SEXP _euclid_transform_prod(SEXP, SEXP);
 extern SEXP _euclid_transform_subset(SEXP, SEXP);
@@ -2417,19 +2786,23 @@ extern SEXP _euclid_transform_to_array(SEXP);
 extern SEXP _euclid_transform_unique(SEXP);
 extern SEXP _euclid_vector_2_add_vector(SEXP, SEXP);
 extern SEXP _euclid_vector_2_cumsum(SEXP);
+extern SEXP _euclid_vector_2_determinant(SEXP, SEXP);
 extern SEXP _euclid_vector_2_divide_numeric(SEXP, SEXP);
 extern SEXP _euclid_vector_2_dot_vector(SEXP, SEXP);
 extern SEXP _euclid_vector_2_minus_vector(SEXP, SEXP);
 extern SEXP _euclid_vector_2_negate(SEXP);
 extern SEXP _euclid_vector_2_sum(SEXP, SEXP);
+extern SEXP _euclid_vector_2_sum_of_products(SEXP, SEXP, SEXP);
 extern SEXP _euclid_vector_2_times_numeric(SEXP, SEXP);
 extern SEXP _euclid_vector_3_add_vector(SEXP, SEXP);
 extern SEXP _euclid_vector_3_cumsum(SEXP);
+extern SEXP _euclid_vector_3_determinant(SEXP, SEXP, SEXP);
 extern SEXP _euclid_vector_3_divide_numeric(SEXP, SEXP);
 extern SEXP _euclid_vector_3_dot_vector(SEXP, SEXP);
 extern SEXP _euclid_vector_3_minus_vector(SEXP, SEXP);
 extern SEXP _euclid_vector_3_negate(SEXP);
 extern SEXP _euclid_vector_3_sum(SEXP, SEXP);
+extern SEXP _euclid_vector_3_sum_of_products(SEXP, SEXP, SEXP);
 extern SEXP _euclid_vector_3_times_numeric(SEXP, SEXP);
 
 static const R_CallMethodDef CallEntries[] = {
@@ -2442,12 +2815,15 @@ static const R_CallMethodDef CallEntries[] = {
     {"_euclid_bbox_dimension",                      (DL_FUNC) &_euclid_bbox_dimension,                      1},
     {"_euclid_bbox_duplicated",                     (DL_FUNC) &_euclid_bbox_duplicated,                     1},
     {"_euclid_bbox_format",                         (DL_FUNC) &_euclid_bbox_format,                         1},
+    {"_euclid_bbox_group_sum",                      (DL_FUNC) &_euclid_bbox_group_sum,                      3},
     {"_euclid_bbox_is_equal",                       (DL_FUNC) &_euclid_bbox_is_equal,                       2},
     {"_euclid_bbox_is_na",                          (DL_FUNC) &_euclid_bbox_is_na,                          1},
     {"_euclid_bbox_length",                         (DL_FUNC) &_euclid_bbox_length,                         1},
     {"_euclid_bbox_match",                          (DL_FUNC) &_euclid_bbox_match,                          2},
+    {"_euclid_bbox_memory_usage",                   (DL_FUNC) &_euclid_bbox_memory_usage,                   1},
     {"_euclid_bbox_overlaps",                       (DL_FUNC) &_euclid_bbox_overlaps,                       2},
     {"_euclid_bbox_plus",                           (DL_FUNC) &_euclid_bbox_plus,                           2},
+    {"_euclid_bbox_spatial_order",                  (DL_FUNC) &_euclid_bbox_spatial_order,                  2},
     {"_euclid_bbox_subset",                         (DL_FUNC) &_euclid_bbox_subset,                         2},
     {"_euclid_bbox_sum",                            (DL_FUNC) &_euclid_bbox_sum,                            2},
     {"_euclid_bbox_to_matrix",                      (DL_FUNC) &_euclid_bbox_to_matrix,                      1},
@@ -2587,22 +2963,31 @@ static const R_CallMethodDef CallEntries[] = {
     {"_euclid_exact_numeric_abs",                   (DL_FUNC) &_euclid_exact_numeric_abs,                   1},
     {"_euclid_exact_numeric_any_duplicated",        (DL_FUNC) &_euclid_exact_numeric_any_duplicated,        1},
     {"_euclid_exact_numeric_any_na",                (DL_FUNC) &_euclid_exact_numeric_any_na,                1},
+    {"_euclid_exact_numeric_approximate",           (DL_FUNC) &_euclid_exact_numeric_approximate,           1},
     {"_euclid_exact_numeric_assign",                (DL_FUNC) &_euclid_exact_numeric_assign,                3},
+    {"_euclid_exact_numeric_bit_length",            (DL_FUNC) &_euclid_exact_numeric_bit_length,            1},
     {"_euclid_exact_numeric_combine",               (DL_FUNC) &_euclid_exact_numeric_combine,               2},
     {"_euclid_exact_numeric_cummax",                (DL_FUNC) &_euclid_exact_numeric_cummax,                1},
     {"_euclid_exact_numeric_cummin",                (DL_FUNC) &_euclid_exact_numeric_cummin,                1},
     {"_euclid_exact_numeric_cumprod",               (DL_FUNC) &_euclid_exact_numeric_cumprod,               1},
     {"_euclid_exact_numeric_cumsum",                (DL_FUNC) &_euclid_exact_numeric_cumsum,                1},
+    {"_euclid_exact_numeric_determinant",           (DL_FUNC) &_euclid_exact_numeric_determinant,           1},
     {"_euclid_exact_numeric_diff",                  (DL_FUNC) &_euclid_exact_numeric_diff,                  2},
     {"_euclid_exact_numeric_divided",               (DL_FUNC) &_euclid_exact_numeric_divided,               2},
     {"_euclid_exact_numeric_duplicated",            (DL_FUNC) &_euclid_exact_numeric_duplicated,            1},
     {"_euclid_exact_numeric_greater",               (DL_FUNC) &_euclid_exact_numeric_greater,               2},
+    {"_euclid_exact_numeric_group_max",             (DL_FUNC) &_euclid_exact_numeric_group_max,             3},
+    {"_euclid_exact_numeric_group_min",             (DL_FUNC) &_euclid_exact_numeric_group_min,             3},
+    {"_euclid_exact_numeric_group_sum",             (DL_FUNC) &_euclid_exact_numeric_group_sum,             3},
     {"_euclid_exact_numeric_is_equal",              (DL_FUNC) &_euclid_exact_numeric_is_equal,              2},
     {"_euclid_exact_numeric_is_na",                 (DL_FUNC) &_euclid_exact_numeric_is_na,                 1},
     {"_euclid_exact_numeric_length",                (DL_FUNC) &_euclid_exact_numeric_length,                1},
     {"_euclid_exact_numeric_less",                  (DL_FUNC) &_euclid_exact_numeric_less,                  2},
     {"_euclid_exact_numeric_match",                 (DL_FUNC) &_euclid_exact_numeric_match,                 2},
+    {"_euclid_exact_numeric_materialize",           (DL_FUNC) &_euclid_exact_numeric_materialize,           1},
     {"_euclid_exact_numeric_max",                   (DL_FUNC) &_euclid_exact_numeric_max,                   2},
+    {"_euclid_exact_numeric_max_bit_length",        (DL_FUNC) &_euclid_exact_numeric_max_bit_length,        1},
+    {"_euclid_exact_numeric_memory_usage",          (DL_FUNC) &_euclid_exact_numeric_memory_usage,          1},
     {"_euclid_exact_numeric_min",                   (DL_FUNC) &_euclid_exact_numeric_min,                   2},
     {"_euclid_exact_numeric_minus",                 (DL_FUNC) &_euclid_exact_numeric_minus,                 2},
     {"_euclid_exact_numeric_plus",                  (DL_FUNC) &_euclid_exact_numeric_plus,                  2},
@@ -2612,41 +2997,55 @@ static const R_CallMethodDef CallEntries[] = {
     {"_euclid_exact_numeric_sort",                  (DL_FUNC) &_euclid_exact_numeric_sort,                  3},
     {"_euclid_exact_numeric_subset",                (DL_FUNC) &_euclid_exact_numeric_subset,                2},
     {"_euclid_exact_numeric_sum",                   (DL_FUNC) &_euclid_exact_numeric_sum,                   2},
+    {"_euclid_exact_numeric_sum_of_products",       (DL_FUNC) &_euclid_exact_numeric_sum_of_products,       3},
     {"_euclid_exact_numeric_times",                 (DL_FUNC) &_euclid_exact_numeric_times,                 2},
     {"_euclid_exact_numeric_to_numeric",            (DL_FUNC) &_euclid_exact_numeric_to_numeric,            1},
     {"_euclid_exact_numeric_uni_minus",             (DL_FUNC) &_euclid_exact_numeric_uni_minus,             1},
     {"_euclid_exact_numeric_unique",                (DL_FUNC) &_euclid_exact_numeric_unique,                1},
+    {"_euclid_filter_stats_enable",                 (DL_FUNC) &_euclid_filter_stats_enable,                 1},
+    {"_euclid_filter_stats_get",                    (DL_FUNC) &_euclid_filter_stats_get,                    0},
+    {"_euclid_filter_stats_reset",                  (DL_FUNC) &_euclid_filter_stats_reset,                  0},
     {"_euclid_geometry_any_duplicated",             (DL_FUNC) &_euclid_geometry_any_duplicated,             1},
     {"_euclid_geometry_any_na",                     (DL_FUNC) &_euclid_geometry_any_na,                     1},
     {"_euclid_geometry_approx_area",                (DL_FUNC) &_euclid_geometry_approx_area,                1},
     {"_euclid_geometry_approx_length",              (DL_FUNC) &_euclid_geometry_approx_length,              1},
     {"_euclid_geometry_approx_volume",              (DL_FUNC) &_euclid_geometry_approx_volume,              1},
+    {"_euclid_geometry_approximate",                (DL_FUNC) &_euclid_geometry_approximate,                1},
     {"_euclid_geometry_assign",                     (DL_FUNC) &_euclid_geometry_assign,                     3},
     {"_euclid_geometry_barycenter_2",               (DL_FUNC) &_euclid_geometry_barycenter_2,               2},
     {"_euclid_geometry_barycenter_3",               (DL_FUNC) &_euclid_geometry_barycenter_3,               3},
     {"_euclid_geometry_barycenter_4",               (DL_FUNC) &_euclid_geometry_barycenter_4,               4},
     {"_euclid_geometry_bbox",                       (DL_FUNC) &_euclid_geometry_bbox,                       1},
     {"_euclid_geometry_bisector",                   (DL_FUNC) &_euclid_geometry_bisector,                   2},
+    {"_euclid_geometry_bit_length",                 (DL_FUNC) &_euclid_geometry_bit_length,                 1},
     {"_euclid_geometry_cardinality",                (DL_FUNC) &_euclid_geometry_cardinality,                1},
     {"_euclid_geometry_centroid_1",                 (DL_FUNC) &_euclid_geometry_centroid_1,                 1},
     {"_euclid_geometry_centroid_3",                 (DL_FUNC) &_euclid_geometry_centroid_3,                 3},
     {"_euclid_geometry_centroid_4",                 (DL_FUNC) &_euclid_geometry_centroid_4,                 4},
+    {"_euclid_geometry_chamfer_distance",           (DL_FUNC) &_euclid_geometry_chamfer_distance,           3},
     {"_euclid_geometry_combine",                    (DL_FUNC) &_euclid_geometry_combine,                    2},
     {"_euclid_geometry_constant_in",                (DL_FUNC) &_euclid_geometry_constant_in,                2},
+    {"_euclid_geometry_convex_hull",                (DL_FUNC) &_euclid_geometry_convex_hull,                2},
     {"_euclid_geometry_copy",                       (DL_FUNC) &_euclid_geometry_copy,                       1},
     {"_euclid_geometry_definition",                 (DL_FUNC) &_euclid_geometry_definition,                 3},
     {"_euclid_geometry_definition_names",           (DL_FUNC) &_euclid_geometry_definition_names,           1},
+    {"_euclid_geometry_delaunay_triangulation",     (DL_FUNC) &_euclid_geometry_delaunay_triangulation,     1},
     {"_euclid_geometry_dimension",                  (DL_FUNC) &_euclid_geometry_dimension,                  1},
     {"_euclid_geometry_distance_matrix",            (DL_FUNC) &_euclid_geometry_distance_matrix,            2},
     {"_euclid_geometry_do_intersect",               (DL_FUNC) &_euclid_geometry_do_intersect,               2},
     {"_euclid_geometry_duplicated",                 (DL_FUNC) &_euclid_geometry_duplicated,                 1},
     {"_euclid_geometry_equidistant_line",           (DL_FUNC) &_euclid_geometry_equidistant_line,           3},
     {"_euclid_geometry_format",                     (DL_FUNC) &_euclid_geometry_format,                     1},
+    {"_euclid_geometry_group_centroid",             (DL_FUNC) &_euclid_geometry_group_centroid,             3},
+    {"_euclid_geometry_group_max",                  (DL_FUNC) &_euclid_geometry_group_max,                  3},
+    {"_euclid_geometry_group_min",                  (DL_FUNC) &_euclid_geometry_group_min,                  3},
+    {"_euclid_geometry_group_sum",                  (DL_FUNC) &_euclid_geometry_group_sum,                  3},
     {"_euclid_geometry_has_point_inside",           (DL_FUNC) &_euclid_geometry_has_point_inside,           2},
     {"_euclid_geometry_has_point_on",               (DL_FUNC) &_euclid_geometry_has_point_on,               2},
     {"_euclid_geometry_has_point_on_negative",      (DL_FUNC) &_euclid_geometry_has_point_on_negative,      2},
     {"_euclid_geometry_has_point_on_positive",      (DL_FUNC) &_euclid_geometry_has_point_on_positive,      2},
     {"_euclid_geometry_has_point_outside",          (DL_FUNC) &_euclid_geometry_has_point_outside,          2},
+    {"_euclid_geometry_hausdorff_distance",         (DL_FUNC) &_euclid_geometry_hausdorff_distance,         3},
     {"_euclid_geometry_intersection",               (DL_FUNC) &_euclid_geometry_intersection,               2},
     {"_euclid_geometry_is_degenerate",              (DL_FUNC) &_euclid_geometry_is_degenerate,              1},
     {"_euclid_geometry_is_equal",                   (DL_FUNC) &_euclid_geometry_is_equal,                   2},
@@ -2654,16 +3053,25 @@ static const R_CallMethodDef CallEntries[] = {
     {"_euclid_geometry_length",                     (DL_FUNC) &_euclid_geometry_length,                     1},
     {"_euclid_geometry_map_to_plane",               (DL_FUNC) &_euclid_geometry_map_to_plane,               2},
     {"_euclid_geometry_match",                      (DL_FUNC) &_euclid_geometry_match,                      2},
+    {"_euclid_geometry_materialize",                (DL_FUNC) &_euclid_geometry_materialize,                1},
+    {"_euclid_geometry_max_bit_length",             (DL_FUNC) &_euclid_geometry_max_bit_length,             1},
+    {"_euclid_geometry_memory_usage",               (DL_FUNC) &_euclid_geometry_memory_usage,               1},
+    {"_euclid_geometry_min_enclosing",              (DL_FUNC) &_euclid_geometry_min_enclosing,              2},
     {"_euclid_geometry_normal",                     (DL_FUNC) &_euclid_geometry_normal,                     1},
     {"_euclid_geometry_parallel",                   (DL_FUNC) &_euclid_geometry_parallel,                   2},
     {"_euclid_geometry_primitive_type",             (DL_FUNC) &_euclid_geometry_primitive_type,             1},
     {"_euclid_geometry_project_to_line",            (DL_FUNC) &_euclid_geometry_project_to_line,            2},
     {"_euclid_geometry_project_to_plane",           (DL_FUNC) &_euclid_geometry_project_to_plane,           2},
     {"_euclid_geometry_radical_geometry",           (DL_FUNC) &_euclid_geometry_radical_geometry,           2},
+    {"_euclid_geometry_regular_triangulation",      (DL_FUNC) &_euclid_geometry_regular_triangulation,      1},
+    {"_euclid_geometry_self_intersections",         (DL_FUNC) &_euclid_geometry_self_intersections,         1},
+    {"_euclid_geometry_slice_triangles",            (DL_FUNC) &_euclid_geometry_slice_triangles,            2},
+    {"_euclid_geometry_snap_round",                 (DL_FUNC) &_euclid_geometry_snap_round,                 3},
     {"_euclid_geometry_squared_distance",           (DL_FUNC) &_euclid_geometry_squared_distance,           2},
     {"_euclid_geometry_subset",                     (DL_FUNC) &_euclid_geometry_subset,                     2},
     {"_euclid_geometry_to_matrix",                  (DL_FUNC) &_euclid_geometry_to_matrix,                  1},
     {"_euclid_geometry_transform",                  (DL_FUNC) &_euclid_geometry_transform,                  2},
+    {"_euclid_geometry_union_measure",              (DL_FUNC) &_euclid_geometry_union_measure,              3},
     {"_euclid_geometry_unique",                     (DL_FUNC) &_euclid_geometry_unique,                     1},
     {"_euclid_geometry_vertex",                     (DL_FUNC) &_euclid_geometry_vertex,                     2},
     {"_euclid_point_2_add_vector",                  (DL_FUNC) &_euclid_point_2_add_vector,                  2},
@@ -2695,10 +3103,15 @@ static const R_CallMethodDef CallEntries[] = {
     {"_euclid_point_turns",                         (DL_FUNC) &_euclid_point_turns,                         1},
     {"_euclid_point_turns_left",                    (DL_FUNC) &_euclid_point_turns_left,                    3},
     {"_euclid_point_turns_right",                   (DL_FUNC) &_euclid_point_turns_right,                   3},
+    {"_euclid_profile_enable",                      (DL_FUNC) &_euclid_profile_enable,                      1},
+    {"_euclid_profile_get",                         (DL_FUNC) &_euclid_profile_get,                         0},
+    {"_euclid_profile_reset",                       (DL_FUNC) &_euclid_profile_reset,                       0},
     {"_euclid_ray_2_negate",                        (DL_FUNC) &_euclid_ray_2_negate,                        1},
     {"_euclid_ray_3_negate",                        (DL_FUNC) &_euclid_ray_3_negate,                        1},
     {"_euclid_segment_2_negate",                    (DL_FUNC) &_euclid_segment_2_negate,                    1},
     {"_euclid_segment_3_negate",                    (DL_FUNC) &_euclid_segment_3_negate,                    1},
+    {"_euclid_set_materialize_depth",               (DL_FUNC) &_euclid_set_materialize_depth,               1},
+    {"_euclid_set_snap_grid",                       (DL_FUNC) &_euclid_set_snap_grid,                       1},
     {"_euclid_transform_any_duplicated",            (DL_FUNC) &_euclid_transform_any_duplicated,            1},
     {"_euclid_transform_any_na",                    (DL_FUNC) &_euclid_transform_any_na,                    1},
     {"_euclid_transform_assign",                    (DL_FUNC) &_euclid_transform_assign,                    3},
@@ -2715,6 +3128,8 @@ static const R_CallMethodDef CallEntries[] = {
     {"_euclid_transform_is_reflecting",             (DL_FUNC) &_euclid_transform_is_reflecting,             1},
     {"_euclid_transform_length",                    (DL_FUNC) &_euclid_transform_length,                    1},
     {"_euclid_transform_match",                     (DL_FUNC) &_euclid_transform_match,                     2},
+    {"_euclid_transform_materialize",               (DL_FUNC) &_euclid_transform_materialize,               1},
+    {"_euclid_transform_memory_usage",              (DL_FUNC) &_euclid_transform_memory_usage,              1},
     {"_euclid_transform_multiply",                  (DL_FUNC) &_euclid_transform_multiply,                  2},
     {"_euclid_transform_prod",                      (DL_FUNC) &_euclid_transform_prod,                      2},
     {"_euclid_transform_subset",                    (DL_FUNC) &_euclid_transform_subset,                    2},
@@ -2722,19 +3137,23 @@ static const R_CallMethodDef CallEntries[] = {
     {"_euclid_transform_unique",                    (DL_FUNC) &_euclid_transform_unique,                    1},
     {"_euclid_vector_2_add_vector",                 (DL_FUNC) &_euclid_vector_2_add_vector,                 2},
     {"_euclid_vector_2_cumsum",                     (DL_FUNC) &_euclid_vector_2_cumsum,                     1},
+    {"_euclid_vector_2_determinant",                (DL_FUNC) &_euclid_vector_2_determinant,                2},
     {"_euclid_vector_2_divide_numeric",             (DL_FUNC) &_euclid_vector_2_divide_numeric,             2},
     {"_euclid_vector_2_dot_vector",                 (DL_FUNC) &_euclid_vector_2_dot_vector,                 2},
     {"_euclid_vector_2_minus_vector",               (DL_FUNC) &_euclid_vector_2_minus_vector,               2},
     {"_euclid_vector_2_negate",                     (DL_FUNC) &_euclid_vector_2_negate,                     1},
     {"_euclid_vector_2_sum",                        (DL_FUNC) &_euclid_vector_2_sum,                        2},
+    {"_euclid_vector_2_sum_of_products",            (DL_FUNC) &_euclid_vector_2_sum_of_products,            3},
     {"_euclid_vector_2_times_numeric",              (DL_FUNC) &_euclid_vector_2_times_numeric,              2},
     {"_euclid_vector_3_add_vector",                 (DL_FUNC) &_euclid_vector_3_add_vector,                 2},
     {"_euclid_vector_3_cumsum",                     (DL_FUNC) &_euclid_vector_3_cumsum,                     1},
+    {"_euclid_vector_3_determinant",                (DL_FUNC) &_euclid_vector_3_determinant,                3},
     {"_euclid_vector_3_divide_numeric",             (DL_FUNC) &_euclid_vector_3_divide_numeric,             2},
     {"_euclid_vector_3_dot_vector",                 (DL_FUNC) &_euclid_vector_3_dot_vector,                 2},
     {"_euclid_vector_3_minus_vector",               (DL_FUNC) &_euclid_vector_3_minus_vector,               2},
     {"_euclid_vector_3_negate",                     (DL_FUNC) &_euclid_vector_3_negate,                     1},
     {"_euclid_vector_3_sum",                        (DL_FUNC) &_euclid_vector_3_sum,                        2},
+    {"_euclid_vector_3_sum_of_products",            (DL_FUNC) &_euclid_vector_3_sum_of_products,            3},
     {"_euclid_vector_3_times_numeric",              (DL_FUNC) &_euclid_vector_3_times_numeric,              2},
     {NULL, NULL, 0}
 };
@@ -10,6 +10,7 @@
 
 [[cpp11::register]]
 direction2_p create_direction_2_empty() {
+  Profile_scope profile(__func__);
   std::vector<Direction_2> vec;
   direction2 *result(new direction2(vec));
   return {result};
@@ -17,6 +18,7 @@ direction2_p create_direction_2_empty() {
 
 [[cpp11::register]]
 direction2_p create_direction_2_vec(vector2_p v) {
+  Profile_scope profile(__func__, v);
   std::vector<Direction_2> vec;
   vec.reserve(v->size());
   for (size_t i = 0; i < v->size(); ++i) {
@@ -33,6 +35,7 @@ direction2_p create_direction_2_vec(vector2_p v) {
 
 [[cpp11::register]]
 direction2_p create_direction_2_line(line2_p l) {
+  Profile_scope profile(__func__, l);
   std::vector<Direction_2> vec;
   vec.reserve(l->size());
   for (size_t i = 0; i < l->size(); ++i) {
@@ -49,6 +52,7 @@ direction2_p create_direction_2_line(line2_p l) {
 
 [[cpp11::register]]
 direction2_p create_direction_2_ray(ray2_p r) {
+  Profile_scope profile(__func__, r);
   std::vector<Direction_2> vec;
   vec.reserve(r->size());
   for (size_t i = 0; i < r->size(); ++i) {
@@ -65,6 +69,7 @@ direction2_p create_direction_2_ray(ray2_p r) {
 
 [[cpp11::register]]
 direction2_p create_direction_2_segment(segment2_p s) {
+  Profile_scope profile(__func__, s);
   std::vector<Direction_2> vec;
   vec.reserve(s->size());
   for (size_t i = 0; i < s->size(); ++i) {
@@ -81,6 +86,7 @@ direction2_p create_direction_2_segment(segment2_p s) {
 
 [[cpp11::register]]
 direction2_p create_direction_2_xy(exact_numeric_p x, exact_numeric_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Direction_2> vec;
   vec.reserve(x->size());
   for (size_t i = 0; i < x->size(); ++i) {
@@ -97,6 +103,7 @@ direction2_p create_direction_2_xy(exact_numeric_p x, exact_numeric_p y) {
 
 [[cpp11::register]]
 direction2_p direction_2_negate(direction2_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Direction_2> vec = -(*x);
   direction2 *result(new direction2(vec));
 
@@ -105,16 +112,19 @@ direction2_p direction_2_negate(direction2_p x) {
 
 [[cpp11::register]]
 cpp11::writable::logicals direction_2_less(direction2_p x, direction2_p y) {
+  Profile_scope profile(__func__, x);
   return (*x) < y->get_storage();
 }
 
 [[cpp11::register]]
 cpp11::writable::logicals direction_2_greater(direction2_p x, direction2_p y) {
+  Profile_scope profile(__func__, x);
   return (*x) > y->get_storage();
 }
 
 [[cpp11::register]]
 direction2_p direction_2_sort(direction2_p x, bool decreasing, cpp11::logicals na_last) {
+  Profile_scope profile(__func__, x);
   std::vector<Direction_2> vec = x->sort(decreasing, na_last);
   direction2 *result(new direction2(vec));
 
@@ -123,11 +133,13 @@ direction2_p direction_2_sort(direction2_p x, bool decreasing, cpp11::logicals n
 
 [[cpp11::register]]
 cpp11::writable::integers direction_2_rank(direction2_p x) {
+  Profile_scope profile(__func__, x);
   return x->rank();
 }
 
 [[cpp11::register]]
 direction2_p direction_2_min(direction2_p x, bool na_rm) {
+  Profile_scope profile(__func__, x);
   std::vector<Direction_2> vec = x->min(na_rm);
   direction2 *result(new direction2(vec));
 
@@ -136,6 +148,7 @@ direction2_p direction_2_min(direction2_p x, bool na_rm) {
 
 [[cpp11::register]]
 direction2_p direction_2_max(direction2_p x, bool na_rm) {
+  Profile_scope profile(__func__, x);
   std::vector<Direction_2> vec = x->max(na_rm);
   direction2 *result(new direction2(vec));
 
@@ -144,6 +157,7 @@ direction2_p direction_2_max(direction2_p x, bool na_rm) {
 
 [[cpp11::register]]
 direction2_p direction_2_cummin(direction2_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Direction_2> vec = x->cummin();
   direction2 *result(new direction2(vec));
 
@@ -152,6 +166,7 @@ direction2_p direction_2_cummin(direction2_p x) {
 
 [[cpp11::register]]
 direction2_p direction_2_cummax(direction2_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Direction_2> vec = x->cummax();
   direction2 *result(new direction2(vec));
 
@@ -160,11 +175,13 @@ direction2_p direction_2_cummax(direction2_p x) {
 
 [[cpp11::register]]
 cpp11::writable::logicals direction_2_between(direction2_p x, direction2_p d1, direction2_p d2) {
+  Profile_scope profile(__func__, x);
   return x->between(*d1, *d2);
 }
 
 [[cpp11::register]]
 direction3_p create_direction_3_empty() {
+  Profile_scope profile(__func__);
   std::vector<Direction_3> vec;
   direction3 *result(new direction3(vec));
   return {result};
@@ -172,6 +189,7 @@ direction3_p create_direction_3_empty() {
 
 [[cpp11::register]]
 direction3_p create_direction_3_vec(vector3_p v) {
+  Profile_scope profile(__func__, v);
   std::vector<Direction_3> vec;
   vec.reserve(v->size());
   for (size_t i = 0; i < v->size(); ++i) {
@@ -188,6 +206,7 @@ direction3_p create_direction_3_vec(vector3_p v) {
 
 [[cpp11::register]]
 direction3_p create_direction_3_line(line3_p l) {
+  Profile_scope profile(__func__, l);
   std::vector<Direction_3> vec;
   vec.reserve(l->size());
   for (size_t i = 0; i < l->size(); ++i) {
@@ -204,6 +223,7 @@ direction3_p create_direction_3_line(line3_p l) {
 
 [[cpp11::register]]
 direction3_p create_direction_3_ray(ray3_p r) {
+  Profile_scope profile(__func__, r);
   std::vector<Direction_3> vec;
   vec.reserve(r->size());
   for (size_t i = 0; i < r->size(); ++i) {
@@ -220,6 +240,7 @@ direction3_p create_direction_3_ray(ray3_p r) {
 
 [[cpp11::register]]
 direction3_p create_direction_3_segment(segment3_p s) {
+  Profile_scope profile(__func__, s);
   std::vector<Direction_3> vec;
   vec.reserve(s->size());
   for (size_t i = 0; i < s->size(); ++i) {
@@ -236,6 +257,7 @@ direction3_p create_direction_3_segment(segment3_p s) {
 
 [[cpp11::register]]
 direction3_p create_direction_3_xyz(exact_numeric_p x, exact_numeric_p y, exact_numeric_p z) {
+  Profile_scope profile(__func__, x);
   std::vector<Direction_3> vec;
   vec.reserve(x->size());
   for (size_t i = 0; i < x->size(); ++i) {
@@ -252,6 +274,7 @@ direction3_p create_direction_3_xyz(exact_numeric_p x, exact_numeric_p y, exact_
 
 [[cpp11::register]]
 direction3_p direction_3_negate(direction3_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Direction_3> vec = -(*x);
   direction3 *result(new direction3(vec));
 
@@ -191,6 +191,8 @@ public:
 
     return {maximum};
   }
+  // Serial scans, as running extremes only select among the input directions
+  // and construct nothing (see exact_numeric::cummax())
   std::vector<Direction_2> cummin() const {
     std::vector<Direction_2> result;
     result.reserve(size());
@@ -234,7 +236,7 @@ public:
         cum_max = Direction_2::NA_value();
       }
       if (!is_na) {
-        cum_max = _storage[i] < cum_max ? _storage[i] : cum_max;
+        cum_max = _storage[i] > cum_max ? _storage[i] : cum_max;
       }
       result.push_back(cum_max);
     }
@@ -1,10 +1,20 @@
 #include "geometry_vector.h"
 #include "exact_numeric.h"
+#include "reduce.h"
 #include <cpp11/matrix.hpp>
 #include <cpp11/external_pointer.hpp>
 
+#include <CGAL/Search_traits_2.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/spatial_sort.h>
+
+typedef CGAL::Search_traits_2<Kernel> Search_traits_2;
+typedef CGAL::Search_traits_3<Kernel> Search_traits_3;
+
 [[cpp11::register]]
 exact_numeric_p geometry_squared_distance(geometry_vector_base_p geo1, geometry_vector_base_p geo2) {
+  Profile_scope profile(__func__, geo1);
   std::vector<Exact_number> res = geo1->squared_distance(*geo2);
   exact_numeric* vec(new exact_numeric(res));
   return {vec};
@@ -12,5 +22,137 @@ exact_numeric_p geometry_squared_distance(geometry_vector_base_p geo1, geometry_
 
 [[cpp11::register]]
 cpp11::writable::doubles_matrix geometry_distance_matrix(geometry_vector_base_p geo1, geometry_vector_base_p geo2) {
+  Profile_scope profile(__func__, geo1);
   return geo1->distance_matrix(*geo2);
 }
+
+template<typename T>
+inline bool any_invalid_geo(const std::vector<T>& geo) {
+  for (auto iter = geo.begin(); iter != geo.end(); ++iter) {
+    if (!(*iter)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Directed Hausdorff distance using the early break strategy: the queries are
+// visited in spatial order and a query is only looked up in the tree if it is
+// further away than the running maximum from the previous nearest neighbour.
+// The search is serial, see the note on threading in cgal_types.h
+template<typename Traits, typename T>
+inline Kernel::FT directed_hausdorff_impl(const std::vector<T>& from, const std::vector<T>& to) {
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits> Neighbor_search;
+  typedef typename Neighbor_search::Tree Tree;
+  typedef typename Traits::Point_d Point;
+
+  std::vector<Point> queries(from.begin(), from.end());
+  CGAL::spatial_sort(queries.begin(), queries.end());
+  Tree tree(to.begin(), to.end());
+
+  Kernel::FT max_dist(0);
+  Point last_neighbor;
+  bool has_neighbor = false;
+  for (auto iter = queries.begin(); iter != queries.end(); ++iter) {
+    if (has_neighbor && CGAL::squared_distance(*iter, last_neighbor) <= max_dist) {
+      continue;
+    }
+    Neighbor_search search(tree, *iter, 1);
+    auto nearest = search.begin();
+    if (nearest->second > max_dist) {
+      max_dist = nearest->second;
+    }
+    last_neighbor = nearest->first;
+    has_neighbor = true;
+  }
+
+  return max_dist;
+}
+
+template<typename Traits, typename T>
+inline Kernel::FT directed_chamfer_impl(const std::vector<T>& from, const std::vector<T>& to) {
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits> Neighbor_search;
+  typedef typename Neighbor_search::Tree Tree;
+
+  Tree tree(to.begin(), to.end());
+
+  std::vector<Kernel::FT> dists;
+  dists.reserve(from.size());
+  for (auto iter = from.begin(); iter != from.end(); ++iter) {
+    Neighbor_search search(tree, *iter, 1);
+    dists.push_back(search.begin()->second);
+  }
+  Kernel::FT total = tree_reduce(dists, Kernel::FT(0), [](const Kernel::FT& a, const Kernel::FT& b) -> Kernel::FT {
+    return a + b;
+  });
+
+  return total / Kernel::FT(double(from.size()));
+}
+
+template<typename Traits, typename T>
+inline Exact_number hausdorff_impl(const std::vector<T>& geo1, const std::vector<T>& geo2, bool directed) {
+  if (geo1.size() == 0 || geo2.size() == 0 || any_invalid_geo(geo1) || any_invalid_geo(geo2)) {
+    return Exact_number::NA_value();
+  }
+  Kernel::FT dist = directed_hausdorff_impl<Traits>(geo1, geo2);
+  if (!directed) {
+    dist = CGAL::max(dist, directed_hausdorff_impl<Traits>(geo2, geo1));
+  }
+  return dist;
+}
+
+template<typename Traits, typename T>
+inline Exact_number chamfer_impl(const std::vector<T>& geo1, const std::vector<T>& geo2, bool directed) {
+  if (geo1.size() == 0 || geo2.size() == 0 || any_invalid_geo(geo1) || any_invalid_geo(geo2)) {
+    return Exact_number::NA_value();
+  }
+  Kernel::FT dist = directed_chamfer_impl<Traits>(geo1, geo2);
+  if (!directed) {
+    dist += directed_chamfer_impl<Traits>(geo2, geo1);
+  }
+  return dist;
+}
+
+[[cpp11::register]]
+exact_numeric_p geometry_hausdorff_distance(geometry_vector_base_p geo1, geometry_vector_base_p geo2, bool directed) {
+  Profile_scope profile(__func__, geo1);
+  if (geo1.get() == nullptr || geo2.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  if (geo1->geometry_type() != POINT || geo2->geometry_type() != POINT) {
+    cpp11::stop("Hausdorff distance can only be calculated between point sets");
+  }
+  if (geo1->dimensions() != geo2->dimensions()) {
+    cpp11::stop("Point sets must have the same dimensionality");
+  }
+  std::vector<Exact_number> res;
+  if (geo1->dimensions() == 2) {
+    res.push_back(hausdorff_impl<Search_traits_2>(get_vector_of_geo<Point_2>(*geo1), get_vector_of_geo<Point_2>(*geo2), directed));
+  } else {
+    res.push_back(hausdorff_impl<Search_traits_3>(get_vector_of_geo<Point_3>(*geo1), get_vector_of_geo<Point_3>(*geo2), directed));
+  }
+  exact_numeric* vec(new exact_numeric(res));
+  return {vec};
+}
+
+[[cpp11::register]]
+exact_numeric_p geometry_chamfer_distance(geometry_vector_base_p geo1, geometry_vector_base_p geo2, bool directed) {
+  Profile_scope profile(__func__, geo1);
+  if (geo1.get() == nullptr || geo2.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  if (geo1->geometry_type() != POINT || geo2->geometry_type() != POINT) {
+    cpp11::stop("Chamfer distance can only be calculated between point sets");
+  }
+  if (geo1->dimensions() != geo2->dimensions()) {
+    cpp11::stop("Point sets must have the same dimensionality");
+  }
+  std::vector<Exact_number> res;
+  if (geo1->dimensions() == 2) {
+    res.push_back(chamfer_impl<Search_traits_2>(get_vector_of_geo<Point_2>(*geo1), get_vector_of_geo<Point_2>(*geo2), directed));
+  } else {
+    res.push_back(chamfer_impl<Search_traits_3>(get_vector_of_geo<Point_3>(*geo1), get_vector_of_geo<Point_3>(*geo2), directed));
+  }
+  exact_numeric* vec(new exact_numeric(res));
+  return {vec};
+}
@@ -1,5 +1,7 @@
 #include "exact_numeric.h"
 #include "match.h"
+#include "materialize.h"
+#include "reduce.h"
 
 #include <CGAL/number_utils.h>
 #include <CGAL/utils_classes.h>
@@ -17,12 +19,14 @@
 
 [[cpp11::register]]
 exact_numeric_p create_exact_numeric(cpp11::doubles numeric) {
+  Profile_scope profile(__func__);
   exact_numeric* ex_n(new exact_numeric(numeric));
 
   return {ex_n};
 }
 [[cpp11::register]]
 int exact_numeric_length(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     return 0;
   }
@@ -45,6 +49,7 @@ exact_numeric exact_numeric::subset(cpp11::integers index) const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_subset(exact_numeric_p ex_n, cpp11::integers index) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -69,6 +74,7 @@ exact_numeric exact_numeric::assign(cpp11::integers index, const exact_numeric&
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_assign(exact_numeric_p ex_n, cpp11::integers index, exact_numeric_p value) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr || value.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -89,6 +95,7 @@ exact_numeric exact_numeric::combine(cpp11::list_of< exact_numeric_p > extra) co
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_combine(exact_numeric_p ex_n, cpp11::list_of<exact_numeric_p> extra) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -108,6 +115,7 @@ cpp11::writable::logicals exact_numeric::is_na() const {
 }
 [[cpp11::register]]
 cpp11::writable::logicals exact_numeric_is_na(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -124,6 +132,7 @@ bool exact_numeric::any_na() const {
 }
 [[cpp11::register]]
 bool exact_numeric_any_na(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -145,6 +154,7 @@ cpp11::writable::doubles exact_numeric::as_numeric() const {
 }
 [[cpp11::register]]
 cpp11::writable::doubles exact_numeric_to_numeric(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -174,9 +184,11 @@ cpp11::writable::logicals exact_numeric::operator==(const exact_numeric& x) cons
 }
 [[cpp11::register]]
 cpp11::writable::logicals exact_numeric_is_equal(exact_numeric_p ex_n, exact_numeric_p ex_n2) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr || ex_n2.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
+  exact_numeric_filter_tracker tracker("equal", *ex_n, *ex_n2);
   return (*ex_n) == (*ex_n2);
 }
 
@@ -200,9 +212,11 @@ cpp11::writable::logicals exact_numeric::operator<(const exact_numeric& x) const
 }
 [[cpp11::register]]
 cpp11::writable::logicals exact_numeric_less(exact_numeric_p ex_n, exact_numeric_p ex_n2) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr || ex_n2.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
+  exact_numeric_filter_tracker tracker("less", *ex_n, *ex_n2);
   return (*ex_n) < (*ex_n2);
 }
 
@@ -227,9 +241,11 @@ cpp11::writable::logicals exact_numeric::operator>(const exact_numeric& x) const
 }
 [[cpp11::register]]
 cpp11::writable::logicals exact_numeric_greater(exact_numeric_p ex_n, exact_numeric_p ex_n2) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr || ex_n2.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
+  exact_numeric_filter_tracker tracker("greater", *ex_n, *ex_n2);
   return (*ex_n) > (*ex_n2);
 }
 
@@ -255,6 +271,7 @@ exact_numeric exact_numeric::unique() const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_unique(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -287,6 +304,7 @@ cpp11::writable::logicals exact_numeric::duplicated() const {
 }
 [[cpp11::register]]
 cpp11::writable::logicals exact_numeric_duplicated(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -318,6 +336,7 @@ int exact_numeric::any_duplicated() const {
 }
 [[cpp11::register]]
 int exact_numeric_any_duplicated(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -351,9 +370,11 @@ cpp11::writable::integers exact_numeric::rank() const {
 }
 [[cpp11::register]]
 cpp11::writable::integers exact_numeric_rank(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
+  exact_numeric_filter_tracker tracker("rank", *ex_n, *ex_n);
   return ex_n->rank();
 }
 
@@ -362,6 +383,7 @@ cpp11::writable::integers exact_numeric::match(const exact_numeric& table) const
 }
 [[cpp11::register]]
 cpp11::writable::integers exact_numeric_match(exact_numeric_p ex_n, exact_numeric_p table) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr || table.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -389,6 +411,7 @@ exact_numeric exact_numeric::operator+(const exact_numeric& x) const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_plus(exact_numeric_p ex_n, exact_numeric_p ex_n2) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr || ex_n2.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -417,6 +440,7 @@ exact_numeric exact_numeric::operator-(const exact_numeric& x) const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_minus(exact_numeric_p ex_n, exact_numeric_p ex_n2) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr || ex_n2.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -440,6 +464,7 @@ exact_numeric exact_numeric::operator-() const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_uni_minus(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -468,6 +493,7 @@ exact_numeric exact_numeric::operator*(const exact_numeric& x) const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_times(exact_numeric_p ex_n, exact_numeric_p ex_n2) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr || ex_n2.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -496,6 +522,7 @@ exact_numeric exact_numeric::operator/(const exact_numeric& x) const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_divided(exact_numeric_p ex_n, exact_numeric_p ex_n2) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr || ex_n2.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -519,6 +546,7 @@ exact_numeric exact_numeric::abs() const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_abs(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -526,6 +554,105 @@ exact_numeric_p exact_numeric_abs(exact_numeric_p ex_n) {
   return {new_ex};
 }
 
+exact_numeric exact_numeric::approximate() const {
+  std::vector<Exact_number> result;
+  result.reserve(size());
+
+  for (size_t i = 0; i < size(); ++i) {
+    if (!_storage[i]) {
+      result.push_back(Exact_number::NA_value());
+      continue;
+    }
+    result.push_back(CGAL::to_double(_storage[i].base()));
+  }
+
+  return {result};
+}
+[[cpp11::register]]
+exact_numeric_p exact_numeric_approximate(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
+  if (ex_n.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  exact_numeric* new_ex(new exact_numeric(ex_n->approximate()));
+  return {new_ex};
+}
+
+void exact_numeric::materialize() const {
+  for (size_t i = 0; i < size(); ++i) {
+    materialize_impl(_storage[i]);
+  }
+}
+[[cpp11::register]]
+void exact_numeric_materialize(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
+  if (ex_n.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  ex_n->materialize();
+}
+
+cpp11::writable::doubles exact_numeric::memory_usage() const {
+  Memory_usage usage(size(), sizeof(Exact_number));
+  for (size_t i = 0; i < size(); ++i) {
+    if (!_storage[i]) {
+      continue;
+    }
+    usage.add_number(_storage[i]);
+  }
+  return usage.as_doubles();
+}
+[[cpp11::register]]
+cpp11::writable::doubles exact_numeric_memory_usage(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
+  if (ex_n.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  return ex_n->memory_usage();
+}
+
+cpp11::writable::integers_matrix exact_numeric::bit_length() const {
+  cpp11::writable::integers_matrix result(size(), 2);
+
+  for (size_t i = 0; i < size(); ++i) {
+    Bit_length bits;
+    if (_storage[i]) {
+      bits.add(_storage[i]);
+    }
+    result(i, 0) = bits.valid ? bits.numerator : R_NaInt;
+    result(i, 1) = bits.valid ? bits.denominator : R_NaInt;
+  }
+
+  return result;
+}
+[[cpp11::register]]
+cpp11::writable::integers_matrix exact_numeric_bit_length(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
+  if (ex_n.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  return ex_n->bit_length();
+}
+
+int exact_numeric::max_bit_length() const {
+  Bit_length bits;
+  for (size_t i = 0; i < size(); ++i) {
+    if (!_storage[i] || _storage[i].ptr()->is_lazy()) {
+      continue;
+    }
+    bits.add(_storage[i]);
+  }
+  return bits.max();
+}
+[[cpp11::register]]
+int exact_numeric_max_bit_length(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
+  if (ex_n.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  return ex_n->max_bit_length();
+}
+
 cpp11::writable::integers exact_numeric::sign() const {
   cpp11::writable::integers result(size());
 
@@ -547,6 +674,7 @@ cpp11::writable::integers exact_numeric::sign() const {
 }
 [[cpp11::register]]
 cpp11::writable::integers exact_numeric_sign(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -554,27 +682,13 @@ cpp11::writable::integers exact_numeric_sign(exact_numeric_p ex_n) {
 }
 
 exact_numeric exact_numeric::cumsum() const {
-  std::vector<Exact_number> result;
-  result.reserve(size());
-
-  Exact_number cum_sum = 0.0;
-  bool is_na = false;
-
-  for (size_t i = 0; i < size(); ++i) {
-    if (!is_na && !_storage[i]) {
-      is_na = true;
-      cum_sum = Exact_number::NA_value();
-    }
-    if (!is_na) {
-      cum_sum += _storage[i];
-    }
-    result.push_back(cum_sum);
-  }
-
-  return {result};
+  return {cumulative_scan(_storage, [](const Exact_number& a, const Exact_number& b) -> Exact_number {
+    return a + b;
+  })};
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_cumsum(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -583,27 +697,13 @@ exact_numeric_p exact_numeric_cumsum(exact_numeric_p ex_n) {
 }
 
 exact_numeric exact_numeric::cumprod() const {
-  std::vector<Exact_number> result;
-  result.reserve(size());
-
-  Exact_number cum_prod = 0.0;
-  bool is_na = false;
-
-  for (size_t i = 0; i < size(); ++i) {
-    if (!is_na && !_storage[i]) {
-      is_na = true;
-      cum_prod = Exact_number::NA_value();
-    }
-    if (!is_na) {
-      cum_prod *= _storage[i];
-    }
-    result.push_back(cum_prod);
-  }
-
-  return {result};
+  return {cumulative_scan(_storage, [](const Exact_number& a, const Exact_number& b) -> Exact_number {
+    return a * b;
+  })};
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_cumprod(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -611,6 +711,8 @@ exact_numeric_p exact_numeric_cumprod(exact_numeric_p ex_n) {
   return {new_ex};
 }
 
+// Running extremes only select among the input values and construct nothing,
+// so unlike cumsum() a serial scan builds no history and stays linear
 exact_numeric exact_numeric::cummax() const {
   std::vector<Exact_number> result;
   result.reserve(size());
@@ -634,6 +736,7 @@ exact_numeric exact_numeric::cummax() const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_cummax(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -654,7 +757,7 @@ exact_numeric exact_numeric::cummin() const {
         cum_min = Exact_number::NA_value();
       }
       if (!is_na) {
-        cum_min = CGAL::max(_storage[i], cum_min);
+        cum_min = CGAL::min(_storage[i], cum_min);
       }
       result.push_back(cum_min);
     }
@@ -664,6 +767,7 @@ exact_numeric exact_numeric::cummin() const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_cummin(exact_numeric_p ex_n) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -689,6 +793,7 @@ exact_numeric exact_numeric::diff(int lag) const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_diff(exact_numeric_p ex_n, int lag) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -722,6 +827,7 @@ exact_numeric exact_numeric::sort(bool decreasing, cpp11::logicals na_last) cons
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_sort(exact_numeric_p ex_n, bool decreasing, cpp11::logicals na_last) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -730,17 +836,13 @@ exact_numeric_p exact_numeric_sort(exact_numeric_p ex_n, bool decreasing, cpp11:
 }
 
 exact_numeric exact_numeric::sum(bool na_rm) const {
-  Exact_number total = 0.0;
+  Exact_number total = Exact_number::NA_value();
+  std::vector<Exact_number> values;
 
-  for (size_t i = 0; i < size(); ++i) {
-    if (!_storage[i]) {
-      if (!na_rm) {
-        total = Exact_number::NA_value();
-        break;
-      }
-      continue;
-    }
-    total += _storage[i];
+  if (reduction_values(_storage, na_rm, values)) {
+    total = tree_reduce(values, Exact_number(0.0), [](const Exact_number& a, const Exact_number& b) -> Exact_number {
+      return a + b;
+    });
   }
   std::vector<Exact_number> result;
   result.push_back(total);
@@ -749,6 +851,7 @@ exact_numeric exact_numeric::sum(bool na_rm) const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_sum(exact_numeric_p ex_n, bool na_rm) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -757,17 +860,13 @@ exact_numeric_p exact_numeric_sum(exact_numeric_p ex_n, bool na_rm) {
 }
 
 exact_numeric exact_numeric::prod(bool na_rm) const {
-  Exact_number total = 1.0;
+  Exact_number total = Exact_number::NA_value();
+  std::vector<Exact_number> values;
 
-  for (size_t i = 0; i < size(); ++i) {
-    if (!_storage[i]) {
-      if (!na_rm) {
-        total = Exact_number::NA_value();
-        break;
-      }
-      continue;
-    }
-    total *= _storage[i];
+  if (reduction_values(_storage, na_rm, values)) {
+    total = tree_reduce(values, Exact_number(1.0), [](const Exact_number& a, const Exact_number& b) -> Exact_number {
+      return a * b;
+    });
   }
   std::vector<Exact_number> result;
   result.push_back(total);
@@ -776,6 +875,7 @@ exact_numeric exact_numeric::prod(bool na_rm) const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_prod(exact_numeric_p ex_n, bool na_rm) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -809,6 +909,7 @@ exact_numeric exact_numeric::min(bool na_rm) const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_min(exact_numeric_p ex_n, bool na_rm) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -841,6 +942,7 @@ exact_numeric exact_numeric::max(bool na_rm) const {
 }
 [[cpp11::register]]
 exact_numeric_p exact_numeric_max(exact_numeric_p ex_n, bool na_rm) {
+  Profile_scope profile(__func__, ex_n);
   if (ex_n.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -7,7 +7,11 @@
 #include <cpp11/integers.hpp>
 #include <cpp11/list_of.hpp>
 #include <cpp11/external_pointer.hpp>
+#include <cpp11/matrix.hpp>
 #include "cgal_types.h"
+#include "memory_usage.h"
+#include "filter_stats.h"
+#include "profile.h"
 
 class exact_numeric {
 private:
@@ -77,6 +81,14 @@ public:
   exact_numeric operator/(const exact_numeric& x) const;
 
   exact_numeric abs() const;
+  exact_numeric approximate() const;
+  void materialize() const;
+  cpp11::writable::doubles memory_usage() const;
+  cpp11::writable::integers_matrix bit_length() const;
+  int max_bit_length() const;
+  size_t n_exact() const {
+    return count_exact(_storage);
+  }
   cpp11::writable::integers sign() const;
 
   exact_numeric cumsum() const;
@@ -94,3 +106,8 @@ public:
 };
 
 typedef cpp11::external_pointer<exact_numeric> exact_numeric_p;
+
+inline std::string vector_type_name(const exact_numeric& x) {
+  return "exact_numeric";
+}
+typedef Filter_tracker<exact_numeric, exact_numeric> exact_numeric_filter_tracker;
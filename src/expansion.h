@@ -0,0 +1,556 @@
+#pragma once
+
+#include "cgal_types.h"
+#include "mirror.h"
+#include "reduce.h"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Floating point expansions ---------------------------------------------------
+//
+// Constructions on geometries created from R doubles (transformations,
+// projections, barycenters) often have a result that is itself exactly
+// representable as a double. Going through the kernel would still create a
+// lazy construction node that keeps its inputs alive and will fall back to
+// exact rationals if the result is ever inspected closely. The functions below
+// evaluate these low degree constructions with floating point expansions
+// (Shewchuk, "Adaptive Precision Floating-Point Arithmetic and Fast Robust
+// Geometric Predicates") which represents a value exactly as an unevaluated sum
+// of non-overlapping doubles. If the exact result turns out to be a double it
+// is stored directly, otherwise the caller falls back to the kernel.
+//
+// All error-free transformations are only exact in the absence of overflow
+// and underflow so inputs to products are restricted to a safe exponent range.
+// Any operation leaving that range, or the capacity of the expansion,
+// invalidates it.
+
+class Expansion {
+  static const size_t capacity = 64;
+
+  double _comp[capacity];
+  size_t _n = 0;
+  bool _valid = true;
+
+  static bool safe_factor(double a) {
+    double abs_a = std::abs(a);
+    return abs_a == 0 || (abs_a > 1e-140 && abs_a < 1e140);
+  }
+  static void two_sum(double a, double b, double& x, double& y) {
+    x = a + b;
+    double b_virtual = x - a;
+    double a_virtual = x - b_virtual;
+    y = (a - a_virtual) + (b - b_virtual);
+  }
+  static void fast_two_sum(double a, double b, double& x, double& y) {
+    x = a + b;
+    y = b - (x - a);
+  }
+  static void split(double a, double& hi, double& lo) {
+    // 2^27 + 1
+    double c = 134217729.0 * a;
+    hi = c - (c - a);
+    lo = a - hi;
+  }
+  static void two_product(double a, double b, double& x, double& y) {
+    x = a * b;
+    double a_hi, a_lo, b_hi, b_lo;
+    split(a, a_hi, a_lo);
+    split(b, b_hi, b_lo);
+    double err1 = x - (a_hi * b_hi);
+    double err2 = err1 - (a_lo * b_hi);
+    double err3 = err2 - (a_hi * b_lo);
+    y = (a_lo * b_lo) - err3;
+  }
+  void push(double a) {
+    if (a == 0) {
+      return;
+    }
+    if (_n == capacity || !std::isfinite(a)) {
+      _valid = false;
+      return;
+    }
+    _comp[_n++] = a;
+  }
+
+public:
+  Expansion() {}
+  explicit Expansion(double a) {
+    push(a);
+  }
+  static Expansion product(double a, double b) {
+    Expansion res;
+    if (!safe_factor(a) || !safe_factor(b)) {
+      res._valid = false;
+      return res;
+    }
+    double x, y;
+    two_product(a, b, x, y);
+    res.push(y);
+    res.push(x);
+    return res;
+  }
+
+  static size_t max_size() { return capacity; }
+  size_t size() const { return _n; }
+  bool valid() const { return _valid; }
+  bool is_zero() const { return _valid && _n == 0; }
+  // Approximation of the value, summing from the smallest component
+  double estimate() const {
+    double sum = 0;
+    for (size_t i = 0; i < _n; ++i) {
+      sum += _comp[i];
+    }
+    return sum;
+  }
+
+  Expansion& operator+=(double b) {
+    if (!_valid) {
+      return *this;
+    }
+    double q = b;
+    size_t n = _n;
+    _n = 0;
+    for (size_t i = 0; i < n; ++i) {
+      double q_new, h;
+      two_sum(q, _comp[i], q_new, h);
+      q = q_new;
+      push(h);
+    }
+    push(q);
+    return *this;
+  }
+  Expansion& operator-=(double b) {
+    return *this += -b;
+  }
+  Expansion& operator+=(const Expansion& other) {
+    if (!other._valid) {
+      _valid = false;
+    }
+    for (size_t i = 0; i < other._n && _valid; ++i) {
+      *this += other._comp[i];
+    }
+    return *this;
+  }
+  Expansion& operator-=(const Expansion& other) {
+    if (!other._valid) {
+      _valid = false;
+    }
+    for (size_t i = 0; i < other._n && _valid; ++i) {
+      *this += -other._comp[i];
+    }
+    return *this;
+  }
+  Expansion operator*(double b) const {
+    Expansion res;
+    if (!_valid || !safe_factor(b)) {
+      res._valid = false;
+      return res;
+    }
+    if (_n == 0 || b == 0) {
+      return res;
+    }
+    double q, h, p1, p0, sum;
+    if (!safe_factor(_comp[0])) {
+      res._valid = false;
+      return res;
+    }
+    two_product(_comp[0], b, q, h);
+    res.push(h);
+    for (size_t i = 1; i < _n; ++i) {
+      if (!safe_factor(_comp[i])) {
+        res._valid = false;
+        return res;
+      }
+      two_product(_comp[i], b, p1, p0);
+      two_sum(q, p0, sum, h);
+      res.push(h);
+      fast_two_sum(p1, sum, q, h);
+      res.push(h);
+    }
+    res.push(q);
+    return res;
+  }
+  Expansion operator*(const Expansion& other) const {
+    Expansion res;
+    if (!_valid || !other._valid) {
+      res._valid = false;
+      return res;
+    }
+    for (size_t i = 0; i < other._n && res._valid; ++i) {
+      res += *this * other._comp[i];
+    }
+    return res;
+  }
+
+  // The exact value of the expansion in a number type that can represent all
+  // doubles exactly (e.g. the exact type of the kernel)
+  template<typename NT>
+  NT exact_value() const {
+    NT sum(0);
+    for (size_t i = 0; i < _n; ++i) {
+      sum += NT(_comp[i]);
+    }
+    return sum;
+  }
+
+  // Sets `out` if the expansion is exactly equal to a double
+  bool to_double(double& out) const {
+    if (!_valid) {
+      return false;
+    }
+    out = estimate();
+    Expansion diff = *this;
+    diff -= out;
+    return diff.is_zero();
+  }
+};
+
+inline Expansion expansion_difference(double a, double b) {
+  Expansion res(a);
+  res -= b;
+  return res;
+}
+
+// Coordinates -----------------------------------------------------------------
+
+inline bool exact_coords(const Kernel::Point_2& p, double* out) {
+  return to_double_exact(p.x(), out[0]) && to_double_exact(p.y(), out[1]);
+}
+inline bool exact_coords(const Kernel::Point_3& p, double* out) {
+  return to_double_exact(p.x(), out[0]) && to_double_exact(p.y(), out[1]) && to_double_exact(p.z(), out[2]);
+}
+inline Kernel::Point_2 point_from_coords(const double* coords, const Kernel::Point_2&) {
+  return Kernel::Point_2(coords[0], coords[1]);
+}
+inline Kernel::Point_3 point_from_coords(const double* coords, const Kernel::Point_3&) {
+  return Kernel::Point_3(coords[0], coords[1], coords[2]);
+}
+
+// Constructions ---------------------------------------------------------------
+
+// Applies an affine transformation to a point. Transformations are affine so
+// the cartesian matrix has an implicit last row of (0, ..., 0, 1)
+template<typename Point, typename Aff>
+inline bool expansion_transform(const Point& p, const Aff& trans, Point& out) {
+  const int dim = Point::Ambient_dimension::value;
+  double coords[dim];
+  double result[dim];
+  if (!exact_coords(p, coords)) {
+    return false;
+  }
+  for (int i = 0; i < dim; ++i) {
+    double m;
+    if (!to_double_exact(trans.m(i, dim), m)) {
+      return false;
+    }
+    Expansion val(m);
+    for (int j = 0; j < dim; ++j) {
+      if (!to_double_exact(trans.m(i, j), m)) {
+        return false;
+      }
+      val += Expansion::product(m, coords[j]);
+    }
+    if (!val.to_double(result[i])) {
+      return false;
+    }
+  }
+  out = point_from_coords(result, p);
+  return true;
+}
+
+// Projects a point onto a line going through `base` with direction `dir`.
+// The projection is base + t * dir with t = (p - base) . dir / dir . dir. A
+// candidate is calculated in floating point and accepted if
+// (r - base) * (dir . dir) == dir * ((p - base) . dir) holds exactly
+inline bool expansion_projection(const double* p, const double* base, const double* dir, int dim, double* out) {
+  Expansion num;
+  Expansion denom;
+  for (int i = 0; i < dim; ++i) {
+    num += expansion_difference(p[i], base[i]) * dir[i];
+    denom += Expansion::product(dir[i], dir[i]);
+  }
+  if (!num.valid() || !denom.valid() || denom.is_zero()) {
+    return false;
+  }
+  double t = num.estimate() / denom.estimate();
+  for (int i = 0; i < dim; ++i) {
+    out[i] = base[i] + t * dir[i];
+    if (!std::isfinite(out[i])) {
+      return false;
+    }
+    Expansion check = expansion_difference(out[i], base[i]) * denom;
+    check -= num * dir[i];
+    if (!check.is_zero()) {
+      return false;
+    }
+  }
+  return true;
+}
+// Projects a point onto the hyperplane normal . x + offset == 0:
+// r = p - ((normal . p + offset) / (normal . normal)) * normal. A candidate is
+// calculated in floating point and accepted if
+// (p - r) * (normal . normal) == normal * (normal . p + offset) holds exactly
+inline bool expansion_project_to_hyperplane(const double* p, const double* normal, double offset, int dim, double* out) {
+  Expansion num(offset);
+  Expansion denom;
+  for (int i = 0; i < dim; ++i) {
+    num += Expansion::product(normal[i], p[i]);
+    denom += Expansion::product(normal[i], normal[i]);
+  }
+  if (!num.valid() || !denom.valid() || denom.is_zero()) {
+    return false;
+  }
+  double t = num.estimate() / denom.estimate();
+  for (int i = 0; i < dim; ++i) {
+    out[i] = p[i] - t * normal[i];
+    if (!std::isfinite(out[i])) {
+      return false;
+    }
+    Expansion check = expansion_difference(p[i], out[i]) * denom;
+    check -= num * normal[i];
+    if (!check.is_zero()) {
+      return false;
+    }
+  }
+  return true;
+}
+inline bool expansion_project_to_line(const Kernel::Point_2& p, const Kernel::Line_2& line, Kernel::Point_2& out) {
+  double coords[2], normal[2], offset, result[2];
+  if (!exact_coords(p, coords) || !to_double_exact(line.a(), normal[0]) ||
+      !to_double_exact(line.b(), normal[1]) || !to_double_exact(line.c(), offset)) {
+    return false;
+  }
+  if (!expansion_project_to_hyperplane(coords, normal, offset, 2, result)) {
+    return false;
+  }
+  out = Kernel::Point_2(result[0], result[1]);
+  return true;
+}
+inline bool expansion_project_to_line(const Kernel::Point_3& p, const Kernel::Line_3& line, Kernel::Point_3& out) {
+  double coords[3], base[3], dir[3], result[3];
+  Kernel::Vector_3 v = line.to_vector();
+  if (!exact_coords(p, coords) || !exact_coords(line.point(), base) ||
+      !to_double_exact(v.x(), dir[0]) || !to_double_exact(v.y(), dir[1]) ||
+      !to_double_exact(v.z(), dir[2])) {
+    return false;
+  }
+  if (!expansion_projection(coords, base, dir, 3, result)) {
+    return false;
+  }
+  out = Kernel::Point_3(result[0], result[1], result[2]);
+  return true;
+}
+
+inline bool expansion_project_to_plane(const Kernel::Point_3& p, const Kernel::Plane_3& plane, Kernel::Point_3& out) {
+  double coords[3], normal[3], offset, result[3];
+  if (!exact_coords(p, coords) || !to_double_exact(plane.a(), normal[0]) ||
+      !to_double_exact(plane.b(), normal[1]) || !to_double_exact(plane.c(), normal[2]) ||
+      !to_double_exact(plane.d(), offset)) {
+    return false;
+  }
+  if (!expansion_project_to_hyperplane(coords, normal, offset, 3, result)) {
+    return false;
+  }
+  out = Kernel::Point_3(result[0], result[1], result[2]);
+  return true;
+}
+
+// Barycenter of n weighted points. A candidate is calculated in floating point
+// and accepted if r * sum(w) == sum(w * p) holds exactly
+template<typename WPoint, typename Point>
+inline bool expansion_barycenter(const WPoint* points, size_t n, Point& out) {
+  const int dim = Point::Ambient_dimension::value;
+  double coords[dim];
+  double result[dim];
+  Expansion weight_sum;
+  Expansion sums[dim];
+  for (size_t k = 0; k < n; ++k) {
+    double w;
+    if (!exact_coords(points[k].point(), coords) || !to_double_exact(points[k].weight(), w)) {
+      return false;
+    }
+    weight_sum += w;
+    for (int i = 0; i < dim; ++i) {
+      sums[i] += Expansion::product(w, coords[i]);
+    }
+  }
+  if (!weight_sum.valid() || weight_sum.is_zero()) {
+    return false;
+  }
+  double total = weight_sum.estimate();
+  for (int i = 0; i < dim; ++i) {
+    if (!sums[i].valid()) {
+      return false;
+    }
+    result[i] = sums[i].estimate() / total;
+    if (!std::isfinite(result[i])) {
+      return false;
+    }
+    Expansion check = weight_sum * result[i];
+    check -= sums[i];
+    if (!check.is_zero()) {
+      return false;
+    }
+  }
+  out = point_from_coords(result, out);
+  return true;
+}
+
+template<typename WPoint>
+using Bare_point = typename std::decay<decltype(std::declval<const WPoint&>().point())>::type;
+
+template<typename WPoint>
+inline Bare_point<WPoint> barycenter_impl(const WPoint& wp1, const WPoint& wp2) {
+  WPoint points[2] = {wp1, wp2};
+  Bare_point<WPoint> result;
+  if (expansion_barycenter(points, 2, result)) {
+    return result;
+  }
+  return CGAL::barycenter(wp1.point(), wp1.weight(), wp2.point(), wp2.weight());
+}
+template<typename WPoint>
+inline Bare_point<WPoint> barycenter_impl(const WPoint& wp1, const WPoint& wp2, const WPoint& wp3) {
+  WPoint points[3] = {wp1, wp2, wp3};
+  Bare_point<WPoint> result;
+  if (expansion_barycenter(points, 3, result)) {
+    return result;
+  }
+  return CGAL::barycenter(wp1.point(), wp1.weight(), wp2.point(), wp2.weight(), wp3.point(), wp3.weight());
+}
+template<typename WPoint>
+inline Bare_point<WPoint> barycenter_impl(const WPoint& wp1, const WPoint& wp2, const WPoint& wp3, const WPoint& wp4) {
+  WPoint points[4] = {wp1, wp2, wp3, wp4};
+  Bare_point<WPoint> result;
+  if (expansion_barycenter(points, 4, result)) {
+    return result;
+  }
+  return CGAL::barycenter(wp1.point(), wp1.weight(), wp2.point(), wp2.weight(), wp3.point(), wp3.weight(), wp4.point(), wp4.weight());
+}
+
+// Fused sums of products ------------------------------------------------------
+//
+// Dot products, determinants and sums of products evaluated term by term in
+// the kernel create a lazy node for every product and every partial sum, all
+// of which stay alive as the history of the result. Fused_sum accumulates
+// products of double inputs in an expansion instead, and turns the exact sum
+// into a single number without history once all terms are added. Terms with
+// inputs that are not doubles (or that fall outside the safe range of the
+// expansion) are computed through the kernel as usual and summed pairwise
+// (see tree_reduce()) so their history stays shallow.
+
+class Fused_sum {
+  typedef Kernel::FT::ET ET;
+
+  Expansion _expansion;
+  ET _flushed;
+  bool _has_expansion = false;
+  bool _has_flushed = false;
+  std::vector<Kernel::FT> _kernel_terms;
+
+  void add_expansion(const Expansion& term) {
+    if (_expansion.size() + term.size() > Expansion::max_size()) {
+      _flushed += _expansion.exact_value<ET>();
+      _has_flushed = true;
+      _expansion = Expansion();
+    }
+    _expansion += term;
+    _has_expansion = true;
+  }
+  void add_kernel(const Kernel::FT& term) {
+    _kernel_terms.push_back(term);
+  }
+  Kernel::FT kernel_sum() const {
+    return tree_reduce(_kernel_terms, Kernel::FT(0), [](const Kernel::FT& a, const Kernel::FT& b) -> Kernel::FT {
+      return a + b;
+    });
+  }
+
+public:
+  Fused_sum() : _flushed(0) {}
+
+  // Adds (or subtracts) a * b
+  void add_product(const Kernel::FT& a, const Kernel::FT& b, bool negate = false) {
+    double x, y;
+    if (to_double_exact(a, x) && to_double_exact(b, y)) {
+      Expansion term = Expansion::product(negate ? -x : x, y);
+      if (term.valid()) {
+        add_expansion(term);
+        return;
+      }
+    }
+    add_kernel(negate ? -(a * b) : a * b);
+  }
+  // Adds (or subtracts) a * b * c
+  void add_product(const Kernel::FT& a, const Kernel::FT& b, const Kernel::FT& c, bool negate = false) {
+    double x, y, z;
+    if (to_double_exact(a, x) && to_double_exact(b, y) && to_double_exact(c, z)) {
+      Expansion term = Expansion::product(negate ? -x : x, y) * z;
+      if (term.valid()) {
+        add_expansion(term);
+        return;
+      }
+    }
+    add_kernel(negate ? -(a * b * c) : a * b * c);
+  }
+
+  Kernel::FT value() const {
+    if (!_has_expansion) {
+      return kernel_sum();
+    }
+    Kernel::FT result;
+    double approx;
+    if (!_has_flushed && _expansion.to_double(approx)) {
+      result = approx;
+    } else {
+      result = Kernel::FT(_flushed + _expansion.exact_value<ET>());
+    }
+    return _kernel_terms.empty() ? result : result + kernel_sum();
+  }
+};
+
+inline Kernel::FT fused_dot(const Kernel::Vector_2& u, const Kernel::Vector_2& v) {
+  Fused_sum sum;
+  sum.add_product(u.x(), v.x());
+  sum.add_product(u.y(), v.y());
+  return sum.value();
+}
+inline Kernel::FT fused_dot(const Kernel::Vector_3& u, const Kernel::Vector_3& v) {
+  Fused_sum sum;
+  sum.add_product(u.x(), v.x());
+  sum.add_product(u.y(), v.y());
+  sum.add_product(u.z(), v.z());
+  return sum.value();
+}
+
+// Determinant of the 2x2 matrix with rows (a, b) and (c, d)
+inline Kernel::FT fused_determinant(const Kernel::FT& a, const Kernel::FT& b,
+                                    const Kernel::FT& c, const Kernel::FT& d) {
+  Fused_sum sum;
+  sum.add_product(a, d);
+  sum.add_product(b, c, true);
+  return sum.value();
+}
+// Determinant of the 3x3 matrix with rows (a, b, c), (d, e, f), and (g, h, i)
+inline Kernel::FT fused_determinant(const Kernel::FT& a, const Kernel::FT& b, const Kernel::FT& c,
+                                    const Kernel::FT& d, const Kernel::FT& e, const Kernel::FT& f,
+                                    const Kernel::FT& g, const Kernel::FT& h, const Kernel::FT& i) {
+  Fused_sum sum;
+  sum.add_product(a, e, i);
+  sum.add_product(b, f, g);
+  sum.add_product(c, d, h);
+  sum.add_product(c, e, g, true);
+  sum.add_product(b, d, i, true);
+  sum.add_product(a, f, h, true);
+  return sum.value();
+}
+inline Kernel::FT fused_determinant(const Kernel::Vector_2& u, const Kernel::Vector_2& v) {
+  return fused_determinant(u.x(), u.y(), v.x(), v.y());
+}
+inline Kernel::FT fused_determinant(const Kernel::Vector_3& u, const Kernel::Vector_3& v, const Kernel::Vector_3& w) {
+  return fused_determinant(u.x(), u.y(), u.z(), v.x(), v.y(), v.z(), w.x(), w.y(), w.z());
+}
@@ -0,0 +1,46 @@
+#include "filter_stats.h"
+#include "profile.h"
+
+#include <cpp11/list.hpp>
+#include <cpp11/strings.hpp>
+#include <cpp11/doubles.hpp>
+
+[[cpp11::register]]
+bool filter_stats_enable(bool enable) {
+  Profile_scope profile(__func__);
+  bool was_enabled = filter_stats_enabled();
+  filter_stats_enabled() = enable;
+  return was_enabled;
+}
+
+[[cpp11::register]]
+void filter_stats_reset() {
+  Profile_scope profile(__func__);
+  filter_registry().clear();
+}
+
+[[cpp11::register]]
+cpp11::writable::list filter_stats_get() {
+  Profile_scope profile(__func__);
+  const Filter_registry& registry = filter_registry();
+  cpp11::writable::strings operation;
+  cpp11::writable::strings type;
+  cpp11::writable::doubles calls;
+  cpp11::writable::doubles evaluated;
+  cpp11::writable::doubles forced;
+  operation.reserve(registry.size());
+  type.reserve(registry.size());
+  calls.reserve(registry.size());
+  evaluated.reserve(registry.size());
+  forced.reserve(registry.size());
+
+  for (auto iter = registry.begin(); iter != registry.end(); ++iter) {
+    operation.push_back(iter->first.first);
+    type.push_back(iter->first.second);
+    calls.push_back(iter->second.calls);
+    evaluated.push_back(iter->second.evaluated);
+    forced.push_back(iter->second.forced);
+  }
+
+  return {operation, type, calls, evaluated, forced};
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <cpp11/list.hpp>
+#include <cpp11/strings.hpp>
+#include <cpp11/doubles.hpp>
+#include "cgal_types.h"
+
+// Opt-in counters of how often exact predicates fail their interval filter.
+// A filter failure forces the exact value of the lazy representations
+// involved, so failures are detected by counting the representations of the
+// input that hold an exact value before and after the operation
+
+struct Filter_count {
+  double calls = 0;
+  double evaluated = 0;
+  double forced = 0;
+};
+
+typedef std::map< std::pair<std::string, std::string>, Filter_count > Filter_registry;
+
+inline bool& filter_stats_enabled() {
+  static bool enabled = false;
+  return enabled;
+}
+inline Filter_registry& filter_registry() {
+  static Filter_registry registry;
+  return registry;
+}
+
+// Number of elements whose lazy representation holds an exact value
+template<typename T>
+inline size_t count_exact(const std::vector<T>& storage) {
+  size_t n = 0;
+  for (size_t i = 0; i < storage.size(); ++i) {
+    if (storage[i] && !storage[i].ptr()->is_lazy()) {
+      ++n;
+    }
+  }
+  return n;
+}
+
+// Records the operation when going out of scope. V1 and V2 must provide
+// size(), n_exact(), and an overload of vector_type_name(). Unary operations
+// pass the same vector as both arguments
+template<typename V1, typename V2>
+class Filter_tracker {
+  const char* _operation;
+  const V1& _x;
+  const V2& _y;
+  bool _enabled;
+  size_t _exact_before;
+
+  bool unary() const {
+    return static_cast<const void*>(&_x) == static_cast<const void*>(&_y);
+  }
+  size_t n_exact() const {
+    return unary() ? _x.n_exact() : _x.n_exact() + _y.n_exact();
+  }
+
+public:
+  Filter_tracker(const char* operation, const V1& x, const V2& y) :
+    _operation(operation),
+    _x(x),
+    _y(y),
+    _enabled(filter_stats_enabled()),
+    _exact_before(0) {
+    if (_enabled) {
+      _exact_before = n_exact();
+    }
+  }
+  ~Filter_tracker() {
+    if (!_enabled) {
+      return;
+    }
+    size_t exact_after = n_exact();
+    std::string type = vector_type_name(_x);
+    if (!unary()) {
+      type += "," + vector_type_name(_y);
+    }
+    Filter_count& count = filter_registry()[std::make_pair(std::string(_operation), type)];
+    count.calls += 1;
+    count.evaluated += std::max(_x.size(), _y.size());
+    count.forced += exact_after - _exact_before;
+  }
+};
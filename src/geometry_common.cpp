@@ -10,31 +10,16 @@
 
 [[cpp11::register]]
 cpp11::writable::strings geometry_primitive_type(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
-  switch (geometries->geometry_type()) {
-  case CIRCLE: return {"circle"};
-  case DIRECTION: return {"direction"};
-  case ISOCUBE: return {"iso_cube"};
-  case ISORECT: return {"iso_rect"};
-  case LINE: return {"line"};
-  case PLANE: return {"plane"};
-  case POINT: return {"point"};
-  case RAY: return {"ray"};
-  case SEGMENT: return {"segment"};
-  case SPHERE: return {"sphere"};
-  case TETRAHEDRON: return {"tetrahedron"};
-  case TRIANGLE: return {"triangle"};
-  case VECTOR: return {"vector"};
-  case WPOINT: return {"point_w"};
-  case VIRTUAL: return {"virtual"};
-  }
-  return {"unknown"};
+  return {primitive_name(geometries->geometry_type())};
 }
 
 [[cpp11::register]]
 int geometry_length(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     return 0;
   }
@@ -43,6 +28,7 @@ int geometry_length(geometry_vector_base_p geometries) {
 
 [[cpp11::register]]
 int geometry_dimension(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     return 0;
   }
@@ -51,6 +37,7 @@ int geometry_dimension(geometry_vector_base_p geometries) {
 
 [[cpp11::register]]
 cpp11::writable::strings geometry_definition_names(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -59,6 +46,7 @@ cpp11::writable::strings geometry_definition_names(geometry_vector_base_p geomet
 
 [[cpp11::register]]
 exact_numeric_p geometry_definition(geometry_vector_base_p geometries, int which, cpp11::integers element) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -69,6 +57,7 @@ exact_numeric_p geometry_definition(geometry_vector_base_p geometries, int which
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_vertex(geometry_vector_base_p geometries, cpp11::integers which) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -77,6 +66,7 @@ geometry_vector_base_p geometry_vertex(geometry_vector_base_p geometries, cpp11:
 
 [[cpp11::register]]
 cpp11::writable::integers geometry_cardinality(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -90,6 +80,7 @@ cpp11::writable::integers geometry_cardinality(geometry_vector_base_p geometries
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_subset(geometry_vector_base_p geometries, cpp11::integers index) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -98,6 +89,7 @@ geometry_vector_base_p geometry_subset(geometry_vector_base_p geometries, cpp11:
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_copy(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -106,6 +98,7 @@ geometry_vector_base_p geometry_copy(geometry_vector_base_p geometries) {
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_assign(geometry_vector_base_p geometries, cpp11::integers index, geometry_vector_base_p value) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr || value.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -114,6 +107,7 @@ geometry_vector_base_p geometry_assign(geometry_vector_base_p geometries, cpp11:
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_combine(geometry_vector_base_p geometries, cpp11::list_of< geometry_vector_base_p > extra) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -122,6 +116,7 @@ geometry_vector_base_p geometry_combine(geometry_vector_base_p geometries, cpp11
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_unique(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -130,6 +125,7 @@ geometry_vector_base_p geometry_unique(geometry_vector_base_p geometries) {
 
 [[cpp11::register]]
 cpp11::writable::logicals geometry_duplicated(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -138,6 +134,7 @@ cpp11::writable::logicals geometry_duplicated(geometry_vector_base_p geometries)
 
 [[cpp11::register]]
 cpp11::writable::integers geometry_any_duplicated(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -146,6 +143,7 @@ cpp11::writable::integers geometry_any_duplicated(geometry_vector_base_p geometr
 
 [[cpp11::register]]
 cpp11::writable::integers geometry_match(geometry_vector_base_p geometries, geometry_vector_base_p table) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr || table.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -154,6 +152,7 @@ cpp11::writable::integers geometry_match(geometry_vector_base_p geometries, geom
 
 [[cpp11::register]]
 cpp11::writable::logicals geometry_is_na(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -162,6 +161,7 @@ cpp11::writable::logicals geometry_is_na(geometry_vector_base_p geometries) {
 
 [[cpp11::register]]
 bool geometry_any_na(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -170,6 +170,7 @@ bool geometry_any_na(geometry_vector_base_p geometries) {
 
 [[cpp11::register]]
 cpp11::writable::doubles_matrix geometry_to_matrix(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -178,6 +179,7 @@ cpp11::writable::doubles_matrix geometry_to_matrix(geometry_vector_base_p geomet
 
 [[cpp11::register]]
 cpp11::writable::strings geometry_format(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     return {">>>Data structure pointer cleared from memory<<<"};
   }
@@ -187,14 +189,17 @@ cpp11::writable::strings geometry_format(geometry_vector_base_p geometries) {
 [[cpp11::register]]
 cpp11::writable::logicals geometry_is_equal(geometry_vector_base_p geometries1,
                                             geometry_vector_base_p geometries2) {
+  Profile_scope profile(__func__, geometries1);
   if (geometries1.get() == nullptr || geometries2.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
+  geometry_filter_tracker tracker("equal", *geometries1, *geometries2);
   return (*geometries1) == (*geometries2);
 }
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_transform(geometry_vector_base_p geometries, transform_vector_base_p affine) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr || affine.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -203,8 +208,62 @@ geometry_vector_base_p geometry_transform(geometry_vector_base_p geometries, tra
 
 [[cpp11::register]]
 bbox_vector_base_p geometry_bbox(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   if (geometries.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
   return geometries->bbox();
 }
+
+[[cpp11::register]]
+geometry_vector_base_p geometry_approximate(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
+  if (geometries.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  return geometries->approximate();
+}
+
+[[cpp11::register]]
+void geometry_materialize(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
+  if (geometries.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  geometries->materialize();
+}
+
+[[cpp11::register]]
+cpp11::writable::doubles geometry_memory_usage(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
+  if (geometries.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  return geometries->memory_usage();
+}
+
+[[cpp11::register]]
+cpp11::writable::integers_matrix geometry_bit_length(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
+  if (geometries.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  return geometries->bit_length();
+}
+
+[[cpp11::register]]
+int geometry_max_bit_length(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
+  if (geometries.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  return geometries->max_bit_length();
+}
+
+[[cpp11::register]]
+int set_materialize_depth(int depth) {
+  Profile_scope profile(__func__);
+  int old_depth = materialize_depth();
+  materialize_depth() = depth;
+  return old_depth;
+}
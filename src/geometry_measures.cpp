@@ -4,13 +4,16 @@
 
 [[cpp11::register]]
 cpp11::writable::doubles geometry_approx_length(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   return geometries->length();
 }
 [[cpp11::register]]
 cpp11::writable::doubles geometry_approx_area(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   return geometries->area();
 }
 [[cpp11::register]]
 cpp11::writable::doubles geometry_approx_volume(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   return geometries->volume();
 }
@@ -6,41 +6,54 @@
 
 [[cpp11::register]]
 cpp11::writable::logicals geometry_is_degenerate(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   return geometries->is_degenerate();
 }
 
 [[cpp11::register]]
 cpp11::writable::logicals geometry_has_point_inside(geometry_vector_base_p geometries, geometry_vector_base_p points) {
+  Profile_scope profile(__func__, geometries);
+  geometry_filter_tracker tracker("has_inside", *geometries, *points);
   return geometries->has_inside(*points);
 }
 
 [[cpp11::register]]
 cpp11::writable::logicals geometry_has_point_on(geometry_vector_base_p geometries, geometry_vector_base_p points) {
+  Profile_scope profile(__func__, geometries);
+  geometry_filter_tracker tracker("has_on", *geometries, *points);
   return geometries->has_on(*points);
 }
 
 [[cpp11::register]]
 cpp11::writable::logicals geometry_has_point_outside(geometry_vector_base_p geometries, geometry_vector_base_p points) {
+  Profile_scope profile(__func__, geometries);
+  geometry_filter_tracker tracker("has_outside", *geometries, *points);
   return geometries->has_outside(*points);
 }
 
 [[cpp11::register]]
 cpp11::writable::logicals geometry_has_point_on_positive(geometry_vector_base_p geometries, geometry_vector_base_p points) {
+  Profile_scope profile(__func__, geometries);
+  geometry_filter_tracker tracker("has_on_positive", *geometries, *points);
   return geometries->has_on_positive(*points);
 }
 
 [[cpp11::register]]
 cpp11::writable::logicals geometry_has_point_on_negative(geometry_vector_base_p geometries, geometry_vector_base_p points) {
+  Profile_scope profile(__func__, geometries);
+  geometry_filter_tracker tracker("has_on_negative", *geometries, *points);
   return geometries->has_on_negative(*points);
 }
 
 [[cpp11::register]]
 cpp11::writable::logicals geometry_constant_in(geometry_vector_base_p geometries, cpp11::integers coord) {
+  Profile_scope profile(__func__, geometries);
   return geometries->constant_in(coord);
 }
 
 [[cpp11::register]]
 cpp11::writable::logicals geometry_parallel(geometry_vector_base_p geo1, geometry_vector_base_p geo2) {
+  Profile_scope profile(__func__, geo1);
   if (geo1->size() == 0 || geo2->size() == 0) {
     return {};
   }
@@ -2,20 +2,24 @@
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_project_to_line(geometry_vector_base_p geometries, geometry_vector_base_p lines) {
+  Profile_scope profile(__func__, geometries);
   return geometries->project_to_line(*lines);
 }
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_project_to_plane(geometry_vector_base_p geometries, geometry_vector_base_p planes) {
+  Profile_scope profile(__func__, geometries);
   return geometries->project_to_plane(*planes);
 }
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_map_to_plane(geometry_vector_base_p geometries, geometry_vector_base_p planes) {
+  Profile_scope profile(__func__, geometries);
   return geometries->map_to_plane(*planes);
 }
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_normal(geometry_vector_base_p geometries) {
+  Profile_scope profile(__func__, geometries);
   return geometries->normal();
 }
@@ -1,8 +1,33 @@
 #pragma once
 
 #include "cgal_types.h"
+#include "expansion.h"
 #include <cpp11/protect.hpp>
 
+// Projection of points defined by doubles are first attempted with expansion
+// arithmetic (see expansion.h)
+inline Kernel::Point_2 project_point(const Kernel::Line_2& line, const Kernel::Point_2& p) {
+  Kernel::Point_2 result;
+  if (expansion_project_to_line(p, line, result)) {
+    return result;
+  }
+  return line.projection(p);
+}
+inline Kernel::Point_3 project_point(const Kernel::Line_3& line, const Kernel::Point_3& p) {
+  Kernel::Point_3 result;
+  if (expansion_project_to_line(p, line, result)) {
+    return result;
+  }
+  return line.projection(p);
+}
+inline Kernel::Point_3 project_point(const Kernel::Plane_3& plane, const Kernel::Point_3& p) {
+  Kernel::Point_3 result;
+  if (expansion_project_to_plane(p, plane, result)) {
+    return result;
+  }
+  return plane.projection(p);
+}
+
 // project_to_line -------------------------------------------------------------
 
 template<typename T, typename Line>
@@ -11,11 +36,11 @@ inline T project_to_line_impl(const T& geo, const Line& line) {
 }
 template<>
 inline Circle_2 project_to_line_impl(const Circle_2& geo, const Line_2& line) {
-  return Circle_2(line.projection(geo.center()), geo.squared_radius());
+  return Circle_2(project_point(line, geo.center()), geo.squared_radius());
 }
 template<>
 inline Circle_3 project_to_line_impl(const Circle_3& geo, const Line_3& line) {
-  return Circle_3(line.projection(geo.center()), geo.squared_radius(), geo.supporting_plane());
+  return Circle_3(project_point(line, geo.center()), geo.squared_radius(), geo.supporting_plane());
 }
 template<>
 inline Direction_2 project_to_line_impl(const Direction_2& geo, const Line_2& line) {
@@ -35,63 +60,63 @@ inline Line_3 project_to_line_impl(const Line_3& geo, const Line_3& line) {
 }
 template<>
 inline Point_2 project_to_line_impl(const Point_2& geo, const Line_2& line) {
-  return line.projection(geo);
+  return project_point(line, geo);
 }
 template<>
 inline Point_3 project_to_line_impl(const Point_3& geo, const Line_3& line) {
-  return line.projection(geo);
+  return project_point(line, geo);
 }
 template<>
 inline Ray_2 project_to_line_impl(const Ray_2& geo, const Line_2& line) {
-  return Ray_2(line.projection(geo.source()), line);
+  return Ray_2(project_point(line, geo.source()), line);
 }
 template<>
 inline Ray_3 project_to_line_impl(const Ray_3& geo, const Line_3& line) {
-  return Ray_3(line.projection(geo.source()), line);
+  return Ray_3(project_point(line, geo.source()), line);
 }
 template<>
 inline Segment_2 project_to_line_impl(const Segment_2& geo, const Line_2& line) {
-  return Segment_2(line.projection(geo.source()), line.projection(geo.target()));
+  return Segment_2(project_point(line, geo.source()), project_point(line, geo.target()));
 }
 template<>
 inline Segment_3 project_to_line_impl(const Segment_3& geo, const Line_3& line) {
-  return Segment_3(line.projection(geo.source()), line.projection(geo.target()));
+  return Segment_3(project_point(line, geo.source()), project_point(line, geo.target()));
 }
 template<>
 inline Sphere project_to_line_impl(const Sphere& geo, const Line_3& line) {
-  return Sphere(line.projection(geo.center()), geo.squared_radius());
+  return Sphere(project_point(line, geo.center()), geo.squared_radius());
 }
 template<>
 inline Tetrahedron project_to_line_impl(const Tetrahedron& geo, const Line_3& line) {
-  return Tetrahedron(line.projection(geo[0]), line.projection(geo[1]), line.projection(geo[2]), line.projection(geo[3]));
+  return Tetrahedron(project_point(line, geo[0]), project_point(line, geo[1]), project_point(line, geo[2]), project_point(line, geo[3]));
 }
 template<>
 inline Triangle_2 project_to_line_impl(const Triangle_2& geo, const Line_2& line) {
-  return Triangle_2(line.projection(geo[0]), line.projection(geo[1]), line.projection(geo[2]));
+  return Triangle_2(project_point(line, geo[0]), project_point(line, geo[1]), project_point(line, geo[2]));
 }
 template<>
 inline Triangle_3 project_to_line_impl(const Triangle_3& geo, const Line_3& line) {
-  return Triangle_3(line.projection(geo[0]), line.projection(geo[1]), line.projection(geo[2]));
+  return Triangle_3(project_point(line, geo[0]), project_point(line, geo[1]), project_point(line, geo[2]));
 }
 template<>
 inline Vector_2 project_to_line_impl(const Vector_2& geo, const Line_2& line) {
-  Point_2 source = line.projection(Point_2(0, 0));
-  Point_2 target = line.projection(Point_2(geo.x(), geo.y()));
+  Point_2 source = project_point(line, Point_2(0, 0));
+  Point_2 target = project_point(line, Point_2(geo.x(), geo.y()));
   return target - source;
 }
 template<>
 inline Vector_3 project_to_line_impl(const Vector_3& geo, const Line_3& line) {
-  Point_3 source = line.projection(Point_3(0, 0, 0));
-  Point_3 target = line.projection(Point_3(geo.x(), geo.y(), geo.z()));
+  Point_3 source = project_point(line, Point_3(0, 0, 0));
+  Point_3 target = project_point(line, Point_3(geo.x(), geo.y(), geo.z()));
   return target - source;
 }
 template<>
 inline Weighted_point_2 project_to_line_impl(const Weighted_point_2& geo, const Line_2& line) {
-  return Weighted_point_2(line.projection(geo.point()), geo.weight());
+  return Weighted_point_2(project_point(line, geo.point()), geo.weight());
 }
 template<>
 inline Weighted_point_3 project_to_line_impl(const Weighted_point_3& geo, const Line_3& line) {
-  return Weighted_point_3(line.projection(geo.point()), geo.weight());
+  return Weighted_point_3(project_point(line, geo.point()), geo.weight());
 }
 
 
@@ -103,11 +128,11 @@ inline T project_to_plane_impl(const T& geo, const Plane& plane) {
 }
 template<>
 inline Circle_3 project_to_plane_impl(const Circle_3& geo, const Plane& plane) {
-  return Circle_3(plane.projection(geo.center()), geo.squared_radius(), plane);
+  return Circle_3(project_point(plane, geo.center()), geo.squared_radius(), plane);
 }
 template<>
 inline Line_3 project_to_plane_impl(const Line_3& geo, const Plane& plane) {
-  return Line_3(plane.projection(geo.point(0)), plane.projection(geo.point(1)));
+  return Line_3(project_point(plane, geo.point(0)), project_point(plane, geo.point(1)));
 }
 template<>
 inline Plane project_to_plane_impl(const Plane& geo, const Plane& plane) {
@@ -115,32 +140,32 @@ inline Plane project_to_plane_impl(const Plane& geo, const Plane& plane) {
 }
 template<>
 inline Point_3 project_to_plane_impl(const Point_3& geo, const Plane& plane) {
-  return plane.projection(geo);
+  return project_point(plane, geo);
 }
 template<>
 inline Ray_3 project_to_plane_impl(const Ray_3& geo, const Plane& plane) {
-  return Ray_3(plane.projection(geo.source()), plane.projection(geo.point(1)));
+  return Ray_3(project_point(plane, geo.source()), project_point(plane, geo.point(1)));
 }
 template<>
 inline Segment_3 project_to_plane_impl(const Segment_3& geo, const Plane& plane) {
-  return Segment_3(plane.projection(geo.source()), plane.projection(geo.target()));
+  return Segment_3(project_point(plane, geo.source()), project_point(plane, geo.target()));
 }
 template<>
 inline Sphere project_to_plane_impl(const Sphere& geo, const Plane& plane) {
-  return Sphere(plane.projection(geo.center()), geo.squared_radius());
+  return Sphere(project_point(plane, geo.center()), geo.squared_radius());
 }
 template<>
 inline Tetrahedron project_to_plane_impl(const Tetrahedron& geo, const Plane& plane) {
-  return Tetrahedron(plane.projection(geo[0]), plane.projection(geo[1]), plane.projection(geo[2]), plane.projection(geo[3]));
+  return Tetrahedron(project_point(plane, geo[0]), project_point(plane, geo[1]), project_point(plane, geo[2]), project_point(plane, geo[3]));
 }
 template<>
 inline Triangle_3 project_to_plane_impl(const Triangle_3& geo, const Plane& plane) {
-  return Triangle_3(plane.projection(geo[0]), plane.projection(geo[1]), plane.projection(geo[2]));
+  return Triangle_3(project_point(plane, geo[0]), project_point(plane, geo[1]), project_point(plane, geo[2]));
 }
 template<>
 inline Vector_3 project_to_plane_impl(const Vector_3& geo, const Plane& plane) {
-  Point_3 source = plane.projection(Point_3(0, 0, 0));
-  Point_3 target = plane.projection(Point_3(geo.x(), geo.y(), geo.z()));
+  Point_3 source = project_point(plane, Point_3(0, 0, 0));
+  Point_3 target = project_point(plane, Point_3(geo.x(), geo.y(), geo.z()));
   return target - source;
 }
 template<>
@@ -149,7 +174,7 @@ inline Direction_3 project_to_plane_impl(const Direction_3& geo, const Plane& pl
 }
 template<>
 inline Weighted_point_3 project_to_plane_impl(const Weighted_point_3& geo, const Plane& plane) {
-  return Weighted_point_3(plane.projection(geo.point()), geo.weight());
+  return Weighted_point_3(project_point(plane, geo.point()), geo.weight());
 }
 
 
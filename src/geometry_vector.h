@@ -24,6 +24,10 @@
 #include "match.h"
 #include "constant_in.h"
 #include "normal.h"
+#include "mirror.h"
+#include "approximate.h"
+#include "snap.h"
+#include "filter_stats.h"
 
 #include <sstream>
 #include <iomanip>
@@ -46,6 +50,27 @@ enum Primitive {
   WPOINT
 };
 
+inline const char* primitive_name(Primitive type) {
+  switch (type) {
+  case CIRCLE: return "circle";
+  case DIRECTION: return "direction";
+  case ISOCUBE: return "iso_cube";
+  case ISORECT: return "iso_rect";
+  case LINE: return "line";
+  case PLANE: return "plane";
+  case POINT: return "point";
+  case RAY: return "ray";
+  case SEGMENT: return "segment";
+  case SPHERE: return "sphere";
+  case TETRAHEDRON: return "tetrahedron";
+  case TRIANGLE: return "triangle";
+  case VECTOR: return "vector";
+  case WPOINT: return "point_w";
+  case VIRTUAL: return "virtual";
+  }
+  return "unknown";
+}
+
 class geometry_vector_base {
 public:
   geometry_vector_base() {}
@@ -103,6 +128,12 @@ public:
   // Common
   virtual cpp11::external_pointer<geometry_vector_base> transform(const transform_vector_base& affine) const = 0;
   virtual bbox_vector_base_p bbox() const = 0;
+  virtual cpp11::external_pointer<geometry_vector_base> approximate() const = 0;
+  virtual void materialize() const = 0;
+  virtual cpp11::writable::doubles memory_usage() const = 0;
+  virtual size_t n_exact() const = 0;
+  virtual cpp11::writable::integers_matrix bit_length() const = 0;
+  virtual int max_bit_length() const = 0;
 
   // Projections
   virtual cpp11::external_pointer<geometry_vector_base> project_to_line(const geometry_vector_base& lines) const = 0;
@@ -116,6 +147,11 @@ public:
 };
 typedef cpp11::external_pointer<geometry_vector_base> geometry_vector_base_p;
 
+inline std::string vector_type_name(const geometry_vector_base& geometries) {
+  return primitive_name(geometries.geometry_type());
+}
+typedef Filter_tracker<geometry_vector_base, geometry_vector_base> geometry_filter_tracker;
+
 // General constructor
 template<typename T>
 geometry_vector_base_p create_geometry_vector(std::vector<T>& input);
@@ -235,6 +271,7 @@ class geometry_vector : public geometry_vector_base {
 
 protected:
   std::vector<T> _storage;
+  Coordinate_mirror<T> _mirror;
 
 public:
   geometry_vector() {}
@@ -246,10 +283,25 @@ public:
   geometry_vector& operator=(const geometry_vector& copy) const {
     _storage.clear();
     _storage.assign(_storage.end(), copy._storage.begin(), copy._storage.end());
+    _mirror.reset();
     return *this;
   }
   ~geometry_vector() = default;
   const std::vector<T>& get_storage() const { return _storage; }
+  const std::vector<typename Mirror_layout<T>::Grid_point>* grid() const { return _mirror.grid(_storage); }
+  const std::vector<typename Mirror_layout<T>::Double_point>* doubles() const { return _mirror.doubles(_storage); }
+  // Stable order of the valid elements based on the coordinate mirror, if any
+  bool mirror_order(bool decreasing, std::vector<size_t>& order) const {
+    if (grid() != nullptr) {
+      order = mirror_order_impl(_storage, *grid(), decreasing);
+      return true;
+    }
+    if (doubles() != nullptr) {
+      order = mirror_order_impl(_storage, *doubles(), decreasing);
+      return true;
+    }
+    return false;
+  }
 
   // Conversion
   cpp11::writable::doubles_matrix as_numeric() const {
@@ -377,8 +429,14 @@ public:
   // Utility
   size_t size() const { return _storage.size(); }
   T operator[](size_t i) const { return _storage[i]; }
-  void clear() { _storage.clear(); }
-  void push_back(T element) { _storage.push_back(element); }
+  void clear() {
+    _storage.clear();
+    _mirror.reset();
+  }
+  void push_back(T element) {
+    _storage.push_back(element);
+    _mirror.reset();
+  }
   size_t dimensions() const {
     return dim;
   };
@@ -516,6 +574,16 @@ public:
       return results;
     }
 
+    if (Mirror_layout<T>::n == 1) {
+      const geometry_vector* table_recast = dynamic_cast<const geometry_vector*>(&table);
+      if (grid() != nullptr && table_recast->grid() != nullptr) {
+        return mirror_match_impl(_storage, *grid(), table_recast->_storage, *(table_recast->grid()));
+      }
+      if (doubles() != nullptr && table_recast->doubles() != nullptr) {
+        return mirror_match_impl(_storage, *doubles(), table_recast->_storage, *(table_recast->doubles()));
+      }
+    }
+
     auto table_vec = get_vector_of_geo<T>(table);
 
     return match_impl(_storage, table_vec);
@@ -734,7 +802,7 @@ public:
         result.push_back(T::NA_value());
         continue;
       }
-      result.push_back(transform_impl(_storage[i % size()], (*affine_recast)[i % affine_recast->size()]));
+      result.push_back(snap_construction(transform_impl(_storage[i % size()], (*affine_recast)[i % affine_recast->size()])));
     }
 
     return create_geometry_vector(result);
@@ -756,6 +824,76 @@ public:
 
     return {vec};
   }
+  geometry_vector_base_p approximate() const {
+    std::vector<T> result;
+    result.reserve(size());
+
+    for (size_t i = 0; i < size(); ++i) {
+      if (!_storage[i]) {
+        result.push_back(T::NA_value());
+        continue;
+      }
+      result.push_back(approximate_impl(_storage[i]));
+    }
+
+    return create_geometry_vector(result);
+  }
+  void materialize() const {
+    for (size_t i = 0; i < size(); ++i) {
+      materialize_impl(_storage[i]);
+    }
+  }
+  cpp11::writable::doubles memory_usage() const {
+    Memory_usage usage(size(), sizeof(T));
+    int n_def = def_names().size();
+    for (size_t i = 0; i < size(); ++i) {
+      if (!_storage[i] || !usage.add_handle(_storage[i])) {
+        continue;
+      }
+      for (int which = 0; which < n_def; ++which) {
+        for (size_t j = 0; j < cardinality(i); ++j) {
+          usage.add_derived_number(get_single_definition(i, which, j));
+        }
+      }
+    }
+    return usage.as_doubles();
+  }
+  size_t n_exact() const {
+    return count_exact(_storage);
+  }
+  void add_bit_length(size_t i, int n_def, Bit_length& bits) const {
+    for (int which = 0; which < n_def; ++which) {
+      for (size_t j = 0; j < cardinality(i); ++j) {
+        bits.add(get_single_definition(i, which, j));
+      }
+    }
+  }
+  cpp11::writable::integers_matrix bit_length() const {
+    cpp11::writable::integers_matrix result(size(), 2);
+    int n_def = def_names().size();
+
+    for (size_t i = 0; i < size(); ++i) {
+      Bit_length bits;
+      if (_storage[i]) {
+        add_bit_length(i, n_def, bits);
+      }
+      result(i, 0) = bits.valid ? bits.numerator : R_NaInt;
+      result(i, 1) = bits.valid ? bits.denominator : R_NaInt;
+    }
+
+    return result;
+  }
+  int max_bit_length() const {
+    Bit_length bits;
+    int n_def = def_names().size();
+    for (size_t i = 0; i < size(); ++i) {
+      if (!_storage[i] || _storage[i].ptr()->is_lazy()) {
+        continue;
+      }
+      add_bit_length(i, n_def, bits);
+    }
+    return bits.max();
+  }
 
   // Projections
   geometry_vector_base_p project_to_line(const geometry_vector_base& lines) const {
@@ -778,7 +916,7 @@ public:
         result.push_back(T::NA_value());
         continue;
       }
-      result.push_back(project_to_line_impl(_storage[i % size()], lines_vec[i % lines_vec.size()]));
+      result.push_back(snap_construction(project_to_line_impl(_storage[i % size()], lines_vec[i % lines_vec.size()])));
     }
 
     return create_geometry_vector(result);
@@ -803,7 +941,7 @@ public:
         result.push_back(T::NA_value());
         continue;
       }
-      result.push_back(project_to_plane_impl(_storage[i % size()], planes_vec[i % planes_vec.size()]));
+      result.push_back(snap_construction(project_to_plane_impl(_storage[i % size()], planes_vec[i % planes_vec.size()])));
     }
 
     return create_geometry_vector(result);
@@ -847,3 +985,26 @@ public:
     return create_geometry_vector(result);
   }
 };
+
+// Evaluates a predicate between two 2 dimensional vectors of the given types
+// using the cheapest coordinate mirror they share (see mirror.h). `handled`
+// is set to false if the vectors are of other types or don't share a mirror
+template<typename T, typename U, typename Predicate>
+cpp11::writable::logicals mirror_predicate(const geometry_vector_base& geo1, const geometry_vector_base& geo2,
+                                           const Predicate& predicate, bool& handled) {
+  handled = false;
+  const geometry_vector<T, 2>* x = dynamic_cast< const geometry_vector<T, 2>* >(&geo1);
+  const geometry_vector<U, 2>* y = dynamic_cast< const geometry_vector<U, 2>* >(&geo2);
+  if (x == nullptr || y == nullptr) {
+    return {};
+  }
+  if (x->grid() != nullptr && y->grid() != nullptr) {
+    handled = true;
+    return mirror_predicate_impl(x->get_storage(), *(x->grid()), y->get_storage(), *(y->grid()), predicate);
+  }
+  if (x->doubles() != nullptr && y->doubles() != nullptr) {
+    handled = true;
+    return mirror_predicate_impl(x->get_storage(), *(x->doubles()), y->get_storage(), *(y->doubles()), predicate);
+  }
+  return {};
+}
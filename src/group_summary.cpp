@@ -0,0 +1,257 @@
+#include "cgal_types.h"
+#include "geometry_vector.h"
+#include "exact_numeric.h"
+#include "bbox.h"
+#include "grouping.h"
+#include "reduce.h"
+
+#include <cpp11/integers.hpp>
+#include <cpp11/external_pointer.hpp>
+
+template<typename T>
+struct Group_sum {
+  T operator()(const T& a, const T& b) const { return a + b; }
+};
+template<typename T>
+struct Group_min {
+  T operator()(const T& a, const T& b) const { return b < a ? b : a; }
+};
+template<typename T>
+struct Group_max {
+  T operator()(const T& a, const T& b) const { return b > a ? b : a; }
+};
+
+// Reduces each group with the given binary operator using a pairwise
+// reduction (see tree_reduce()). NA elements makes the result NA unless they
+// are removed, and groups without any valid elements gives NA
+template<typename T, typename Op>
+inline std::vector<T> group_reduce_impl(const std::vector<T>& x, const std::vector< std::vector<int> >& groups, bool na_rm, Op op) {
+  std::vector<T> result;
+  result.reserve(groups.size());
+  std::vector<T> values;
+  for (auto group = groups.begin(); group != groups.end(); ++group) {
+    values.clear();
+    bool is_na = false;
+    for (auto iter = group->begin(); iter != group->end(); ++iter) {
+      if (!x[*iter]) {
+        if (!na_rm) {
+          is_na = true;
+          break;
+        }
+        continue;
+      }
+      values.push_back(x[*iter]);
+    }
+    if (is_na) {
+      result.push_back(T::NA_value());
+      continue;
+    }
+    result.push_back(tree_reduce(values, T::NA_value(), op));
+  }
+  return result;
+}
+
+template<typename T>
+inline std::vector<T> group_centroid_impl(const std::vector<T>& x, const std::vector< std::vector<int> >& groups, bool na_rm) {
+  typedef decltype(x[0] - CGAL::ORIGIN) Vector;
+  std::vector<T> result;
+  result.reserve(groups.size());
+  std::vector<Vector> offsets;
+  for (auto group = groups.begin(); group != groups.end(); ++group) {
+    offsets.clear();
+    bool is_na = false;
+    for (auto iter = group->begin(); iter != group->end(); ++iter) {
+      if (!x[*iter]) {
+        if (!na_rm) {
+          is_na = true;
+          break;
+        }
+        continue;
+      }
+      offsets.push_back(x[*iter] - CGAL::ORIGIN);
+    }
+    if (is_na || offsets.empty()) {
+      result.push_back(T::NA_value());
+      continue;
+    }
+    Vector total = tree_reduce(offsets, Vector(CGAL::NULL_VECTOR), [](const Vector& a, const Vector& b) -> Vector {
+      return a + b;
+    });
+    result.push_back(CGAL::ORIGIN + total / Kernel::FT(double(offsets.size())));
+  }
+  return result;
+}
+
+template<typename T, typename U>
+inline std::vector<U> group_barycenter_impl(const std::vector<T>& x, const std::vector< std::vector<int> >& groups, bool na_rm) {
+  typedef decltype(x[0].point() - CGAL::ORIGIN) Vector;
+  std::vector<U> result;
+  result.reserve(groups.size());
+  std::vector<Vector> offsets;
+  std::vector<Kernel::FT> weights;
+  for (auto group = groups.begin(); group != groups.end(); ++group) {
+    offsets.clear();
+    weights.clear();
+    bool is_na = false;
+    for (auto iter = group->begin(); iter != group->end(); ++iter) {
+      if (!x[*iter]) {
+        if (!na_rm) {
+          is_na = true;
+          break;
+        }
+        continue;
+      }
+      offsets.push_back((x[*iter].point() - CGAL::ORIGIN) * x[*iter].weight());
+      weights.push_back(x[*iter].weight());
+    }
+    if (is_na) {
+      result.push_back(U::NA_value());
+      continue;
+    }
+    Kernel::FT total_weight = tree_reduce(weights, Kernel::FT(0), [](const Kernel::FT& a, const Kernel::FT& b) -> Kernel::FT {
+      return a + b;
+    });
+    if (total_weight == 0) {
+      result.push_back(U::NA_value());
+      continue;
+    }
+    Vector total = tree_reduce(offsets, Vector(CGAL::NULL_VECTOR), [](const Vector& a, const Vector& b) -> Vector {
+      return a + b;
+    });
+    result.push_back(CGAL::ORIGIN + total / total_weight);
+  }
+  return result;
+}
+
+[[cpp11::register]]
+geometry_vector_base_p geometry_group_sum(geometry_vector_base_p geometries, cpp11::integers group, bool na_rm) {
+  Profile_scope profile(__func__, geometries);
+  if (geometries.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  if (geometries->geometry_type() != VECTOR) {
+    cpp11::stop("Grouped sums are only defined for vectors");
+  }
+  std::vector< std::vector<int> > groups = split_groups(group, geometries->size());
+  if (geometries->dimensions() == 2) {
+    std::vector<Vector_2> result = group_reduce_impl(get_vector_of_geo<Vector_2>(*geometries), groups, na_rm, Group_sum<Vector_2>());
+    return create_geometry_vector(result);
+  }
+  std::vector<Vector_3> result = group_reduce_impl(get_vector_of_geo<Vector_3>(*geometries), groups, na_rm, Group_sum<Vector_3>());
+  return create_geometry_vector(result);
+}
+
+[[cpp11::register]]
+geometry_vector_base_p geometry_group_min(geometry_vector_base_p geometries, cpp11::integers group, bool na_rm) {
+  Profile_scope profile(__func__, geometries);
+  if (geometries.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  if (geometries->geometry_type() != POINT) {
+    cpp11::stop("Grouped minimum is only defined for points");
+  }
+  std::vector< std::vector<int> > groups = split_groups(group, geometries->size());
+  if (geometries->dimensions() == 2) {
+    std::vector<Point_2> result = group_reduce_impl(get_vector_of_geo<Point_2>(*geometries), groups, na_rm, Group_min<Point_2>());
+    return create_geometry_vector(result);
+  }
+  std::vector<Point_3> result = group_reduce_impl(get_vector_of_geo<Point_3>(*geometries), groups, na_rm, Group_min<Point_3>());
+  return create_geometry_vector(result);
+}
+
+[[cpp11::register]]
+geometry_vector_base_p geometry_group_max(geometry_vector_base_p geometries, cpp11::integers group, bool na_rm) {
+  Profile_scope profile(__func__, geometries);
+  if (geometries.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  if (geometries->geometry_type() != POINT) {
+    cpp11::stop("Grouped maximum is only defined for points");
+  }
+  std::vector< std::vector<int> > groups = split_groups(group, geometries->size());
+  if (geometries->dimensions() == 2) {
+    std::vector<Point_2> result = group_reduce_impl(get_vector_of_geo<Point_2>(*geometries), groups, na_rm, Group_max<Point_2>());
+    return create_geometry_vector(result);
+  }
+  std::vector<Point_3> result = group_reduce_impl(get_vector_of_geo<Point_3>(*geometries), groups, na_rm, Group_max<Point_3>());
+  return create_geometry_vector(result);
+}
+
+[[cpp11::register]]
+geometry_vector_base_p geometry_group_centroid(geometry_vector_base_p geometries, cpp11::integers group, bool na_rm) {
+  Profile_scope profile(__func__, geometries);
+  if (geometries.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  std::vector< std::vector<int> > groups = split_groups(group, geometries->size());
+  switch (geometries->geometry_type()) {
+  case POINT: {
+    if (geometries->dimensions() == 2) {
+      std::vector<Point_2> result = group_centroid_impl(get_vector_of_geo<Point_2>(*geometries), groups, na_rm);
+      return create_geometry_vector(result);
+    }
+    std::vector<Point_3> result = group_centroid_impl(get_vector_of_geo<Point_3>(*geometries), groups, na_rm);
+    return create_geometry_vector(result);
+  }
+  case WPOINT: {
+    if (geometries->dimensions() == 2) {
+      std::vector<Point_2> result = group_barycenter_impl<Weighted_point_2, Point_2>(get_vector_of_geo<Weighted_point_2>(*geometries), groups, na_rm);
+      return create_geometry_vector(result);
+    }
+    std::vector<Point_3> result = group_barycenter_impl<Weighted_point_3, Point_3>(get_vector_of_geo<Weighted_point_3>(*geometries), groups, na_rm);
+    return create_geometry_vector(result);
+  }
+  default: cpp11::stop("Grouped centroids are only defined for points and weighted points");
+  }
+}
+
+[[cpp11::register]]
+exact_numeric_p exact_numeric_group_sum(exact_numeric_p ex_n, cpp11::integers group, bool na_rm) {
+  Profile_scope profile(__func__, ex_n);
+  if (ex_n.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  std::vector< std::vector<int> > groups = split_groups(group, ex_n->size());
+  std::vector<Exact_number> result = group_reduce_impl(ex_n->get_storage(), groups, na_rm, Group_sum<Exact_number>());
+  exact_numeric* vec(new exact_numeric(result));
+  return {vec};
+}
+
+[[cpp11::register]]
+exact_numeric_p exact_numeric_group_min(exact_numeric_p ex_n, cpp11::integers group, bool na_rm) {
+  Profile_scope profile(__func__, ex_n);
+  if (ex_n.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  std::vector< std::vector<int> > groups = split_groups(group, ex_n->size());
+  std::vector<Exact_number> result = group_reduce_impl(ex_n->get_storage(), groups, na_rm, Group_min<Exact_number>());
+  exact_numeric* vec(new exact_numeric(result));
+  return {vec};
+}
+
+[[cpp11::register]]
+exact_numeric_p exact_numeric_group_max(exact_numeric_p ex_n, cpp11::integers group, bool na_rm) {
+  Profile_scope profile(__func__, ex_n);
+  if (ex_n.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  std::vector< std::vector<int> > groups = split_groups(group, ex_n->size());
+  std::vector<Exact_number> result = group_reduce_impl(ex_n->get_storage(), groups, na_rm, Group_max<Exact_number>());
+  exact_numeric* vec(new exact_numeric(result));
+  return {vec};
+}
+
+[[cpp11::register]]
+bbox_vector_base_p bbox_group_sum(bbox_vector_base_p bboxes, cpp11::integers group, bool na_rm) {
+  Profile_scope profile(__func__, bboxes);
+  if (bboxes.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  std::vector< std::vector<int> > groups = split_groups(group, bboxes->size());
+  if (bboxes->dimensions() == 2) {
+    std::vector<Bbox_2> result = group_reduce_impl(get_vector_of_bbox<Bbox_2>(*bboxes), groups, na_rm, Group_sum<Bbox_2>());
+    return create_bbox_vector(result);
+  }
+  std::vector<Bbox_3> result = group_reduce_impl(get_vector_of_bbox<Bbox_3>(*bboxes), groups, na_rm, Group_sum<Bbox_3>());
+  return create_bbox_vector(result);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+#include <cpp11/integers.hpp>
+
+// Splits the indices of a vector into groups based on a 1-based group id as
+// created by `validate_groups()` on the R side. Groups are returned in the
+// order of their id and elements with an NA group are dropped. The returned
+// indices are 0-based. Groups are processed one at a time, as elements of
+// different groups may share lazy values (see cgal_types.h)
+inline std::vector< std::vector<int> > split_groups(cpp11::integers group, size_t n) {
+  if (static_cast<size_t>(group.size()) != n) {
+    cpp11::stop("The group vector must match the length of the geometries");
+  }
+  int n_groups = 0;
+  for (R_xlen_t i = 0; i < group.size(); ++i) {
+    if (group[i] != R_NaInt && group[i] > n_groups) {
+      n_groups = group[i];
+    }
+  }
+  std::vector< std::vector<int> > result(n_groups);
+  for (R_xlen_t i = 0; i < group.size(); ++i) {
+    if (group[i] == R_NaInt || group[i] < 1) {
+      continue;
+    }
+    result[group[i] - 1].push_back(i);
+  }
+  return result;
+}
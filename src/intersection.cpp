@@ -4,10 +4,13 @@
 
 [[cpp11::register]]
 cpp11::writable::list geometry_intersection(geometry_vector_base_p geo1, geometry_vector_base_p geo2) {
+  Profile_scope profile(__func__, geo1);
   return geo1->intersection(*geo2);
 }
 
 [[cpp11::register]]
 cpp11::writable::logicals geometry_do_intersect(geometry_vector_base_p geo1, geometry_vector_base_p geo2) {
+  Profile_scope profile(__func__, geo1);
+  geometry_filter_tracker tracker("do_intersect", *geo1, *geo2);
   return geo1->do_intersect(*geo2);
 }
@@ -5,6 +5,7 @@
 
 [[cpp11::register]]
 iso_cube_p create_iso_cube_empty() {
+  Profile_scope profile(__func__);
   std::vector<Iso_cuboid> vec;
   iso_cube *result(new iso_cube(vec));
   return {result};
@@ -12,6 +13,7 @@ iso_cube_p create_iso_cube_empty() {
 
 [[cpp11::register]]
 iso_cube_p create_iso_cube_pq(point3_p p, point3_p q) {
+  Profile_scope profile(__func__, p);
   std::vector<Iso_cuboid> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -28,6 +30,7 @@ iso_cube_p create_iso_cube_pq(point3_p p, point3_p q) {
 
 [[cpp11::register]]
 iso_cube_p create_iso_cube_minmax(exact_numeric_p minx, exact_numeric_p miny, exact_numeric_p minz, exact_numeric_p maxx, exact_numeric_p maxy, exact_numeric_p maxz) {
+  Profile_scope profile(__func__, minx);
   std::vector<Iso_cuboid> vec;
   vec.reserve(minx->size());
   for (size_t i = 0; i < minx->size(); ++i) {
@@ -44,6 +47,7 @@ iso_cube_p create_iso_cube_minmax(exact_numeric_p minx, exact_numeric_p miny, ex
 
 [[cpp11::register]]
 iso_cube_p create_iso_cube_bbox(bbox3_p bbox) {
+  Profile_scope profile(__func__, bbox);
   std::vector<Iso_cuboid> vec;
   vec.reserve(bbox->size());
   for (size_t i = 0; i < bbox->size(); ++i) {
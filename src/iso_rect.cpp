@@ -5,6 +5,7 @@
 
 [[cpp11::register]]
 iso_rect_p create_iso_rect_empty() {
+  Profile_scope profile(__func__);
   std::vector<Iso_rectangle> vec;
   iso_rect *result(new iso_rect(vec));
   return {result};
@@ -12,6 +13,7 @@ iso_rect_p create_iso_rect_empty() {
 
 [[cpp11::register]]
 iso_rect_p create_iso_rect_pq(point2_p p, point2_p q) {
+  Profile_scope profile(__func__, p);
   std::vector<Iso_rectangle> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -28,6 +30,7 @@ iso_rect_p create_iso_rect_pq(point2_p p, point2_p q) {
 
 [[cpp11::register]]
 iso_rect_p create_iso_rect_minmax(exact_numeric_p minx, exact_numeric_p miny, exact_numeric_p maxx, exact_numeric_p maxy) {
+  Profile_scope profile(__func__, minx);
   std::vector<Iso_rectangle> vec;
   vec.reserve(minx->size());
   for (size_t i = 0; i < minx->size(); ++i) {
@@ -44,6 +47,7 @@ iso_rect_p create_iso_rect_minmax(exact_numeric_p minx, exact_numeric_p miny, ex
 
 [[cpp11::register]]
 iso_rect_p create_iso_rect_bbox(bbox2_p bbox) {
+  Profile_scope profile(__func__, bbox);
   std::vector<Iso_rectangle> vec;
   vec.reserve(bbox->size());
   for (size_t i = 0; i < bbox->size(); ++i) {
@@ -10,6 +10,7 @@
 
 [[cpp11::register]]
 line2_p create_line_2_empty() {
+  Profile_scope profile(__func__);
   std::vector<Line_2> vec;
   line2 *result(new line2(vec));
   return {result};
@@ -18,6 +19,7 @@ line2_p create_line_2_empty() {
 
 [[cpp11::register]]
 line2_p create_line_2_a_b_c(exact_numeric_p a, exact_numeric_p b, exact_numeric_p c) {
+  Profile_scope profile(__func__, a);
   std::vector<Line_2> vec;
   vec.reserve(a->size());
   for (size_t i = 0; i < a->size(); ++i) {
@@ -34,6 +36,7 @@ line2_p create_line_2_a_b_c(exact_numeric_p a, exact_numeric_p b, exact_numeric_
 
 [[cpp11::register]]
 line2_p create_line_2_p_q(point2_p p, point2_p q) {
+  Profile_scope profile(__func__, p);
   std::vector<Line_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -50,6 +53,7 @@ line2_p create_line_2_p_q(point2_p p, point2_p q) {
 
 [[cpp11::register]]
 line2_p create_line_2_p_d(point2_p p, direction2_p d) {
+  Profile_scope profile(__func__, p);
   std::vector<Line_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -66,6 +70,7 @@ line2_p create_line_2_p_d(point2_p p, direction2_p d) {
 
 [[cpp11::register]]
 line2_p create_line_2_p_v(point2_p p, vector2_p v) {
+  Profile_scope profile(__func__, p);
   std::vector<Line_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -82,6 +87,7 @@ line2_p create_line_2_p_v(point2_p p, vector2_p v) {
 
 [[cpp11::register]]
 line2_p create_line_2_seg(segment2_p s) {
+  Profile_scope profile(__func__, s);
   std::vector<Line_2> vec;
   vec.reserve(s->size());
   for (size_t i = 0; i < s->size(); ++i) {
@@ -98,6 +104,7 @@ line2_p create_line_2_seg(segment2_p s) {
 
 [[cpp11::register]]
 line2_p create_line_2_ray(ray2_p r) {
+  Profile_scope profile(__func__, r);
   std::vector<Line_2> vec;
   vec.reserve(r->size());
   for (size_t i = 0; i < r->size(); ++i) {
@@ -114,6 +121,7 @@ line2_p create_line_2_ray(ray2_p r) {
 
 [[cpp11::register]]
 line3_p create_line_3_empty() {
+  Profile_scope profile(__func__);
   std::vector<Line_3> vec;
   line3 *result(new line3(vec));
   return {result};
@@ -121,6 +129,7 @@ line3_p create_line_3_empty() {
 
 [[cpp11::register]]
 line3_p create_line_3_p_q(point3_p p, point3_p q) {
+  Profile_scope profile(__func__, p);
   std::vector<Line_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -137,6 +146,7 @@ line3_p create_line_3_p_q(point3_p p, point3_p q) {
 
 [[cpp11::register]]
 line3_p create_line_3_p_d(point3_p p, direction3_p d) {
+  Profile_scope profile(__func__, p);
   std::vector<Line_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -153,6 +163,7 @@ line3_p create_line_3_p_d(point3_p p, direction3_p d) {
 
 [[cpp11::register]]
 line3_p create_line_3_p_v(point3_p p, vector3_p v) {
+  Profile_scope profile(__func__, p);
   std::vector<Line_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -169,6 +180,7 @@ line3_p create_line_3_p_v(point3_p p, vector3_p v) {
 
 [[cpp11::register]]
 line3_p create_line_3_seg(segment3_p s) {
+  Profile_scope profile(__func__, s);
   std::vector<Line_3> vec;
   vec.reserve(s->size());
   for (size_t i = 0; i < s->size(); ++i) {
@@ -185,6 +197,7 @@ line3_p create_line_3_seg(segment3_p s) {
 
 [[cpp11::register]]
 line3_p create_line_3_ray(ray3_p r) {
+  Profile_scope profile(__func__, r);
   std::vector<Line_3> vec;
   vec.reserve(r->size());
   for (size_t i = 0; i < r->size(); ++i) {
@@ -4,6 +4,7 @@
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_barycenter_2(geometry_vector_base_p p1, geometry_vector_base_p p2) {
+  Profile_scope profile(__func__, p1);
   if (p1->dimensions() == 2) {
     auto vec1 = get_vector_of_geo<Weighted_point_2>(*p1);
     auto vec2 = get_vector_of_geo<Weighted_point_2>(*p2);
@@ -20,7 +21,7 @@ geometry_vector_base_p geometry_barycenter_2(geometry_vector_base_p p1, geometry
         result.push_back(Point_2::NA_value());
         continue;
       }
-      result.push_back(CGAL::barycenter(wp1.point(), wp1.weight(), wp2.point(), wp2.weight()));
+      result.push_back(snap_construction<Point_2>(barycenter_impl(wp1, wp2)));
     }
     return create_geometry_vector(result);
   } else {
@@ -39,7 +40,7 @@ geometry_vector_base_p geometry_barycenter_2(geometry_vector_base_p p1, geometry
         result.push_back(Point_3::NA_value());
         continue;
       }
-      result.push_back(CGAL::barycenter(wp1.point(), wp1.weight(), wp2.point(), wp2.weight()));
+      result.push_back(snap_construction<Point_3>(barycenter_impl(wp1, wp2)));
     }
     return create_geometry_vector(result);
   }
@@ -47,6 +48,7 @@ geometry_vector_base_p geometry_barycenter_2(geometry_vector_base_p p1, geometry
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_barycenter_3(geometry_vector_base_p p1, geometry_vector_base_p p2, geometry_vector_base_p p3) {
+  Profile_scope profile(__func__, p1);
   if (p1->dimensions() == 2) {
     auto vec1 = get_vector_of_geo<Weighted_point_2>(*p1);
     auto vec2 = get_vector_of_geo<Weighted_point_2>(*p2);
@@ -65,7 +67,7 @@ geometry_vector_base_p geometry_barycenter_3(geometry_vector_base_p p1, geometry
         result.push_back(Point_2::NA_value());
         continue;
       }
-      result.push_back(CGAL::barycenter(wp1.point(), wp1.weight(), wp2.point(), wp2.weight(), wp3.point(), wp3.weight()));
+      result.push_back(snap_construction<Point_2>(barycenter_impl(wp1, wp2, wp3)));
     }
     return create_geometry_vector(result);
   } else {
@@ -86,7 +88,7 @@ geometry_vector_base_p geometry_barycenter_3(geometry_vector_base_p p1, geometry
         result.push_back(Point_3::NA_value());
         continue;
       }
-      result.push_back(CGAL::barycenter(wp1.point(), wp1.weight(), wp2.point(), wp2.weight(), wp3.point(), wp3.weight()));
+      result.push_back(snap_construction<Point_3>(barycenter_impl(wp1, wp2, wp3)));
     }
     return create_geometry_vector(result);
   }
@@ -94,6 +96,7 @@ geometry_vector_base_p geometry_barycenter_3(geometry_vector_base_p p1, geometry
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_barycenter_4(geometry_vector_base_p p1, geometry_vector_base_p p2, geometry_vector_base_p p3, geometry_vector_base_p p4) {
+  Profile_scope profile(__func__, p1);
   if (p1->dimensions() == 2) {
     auto vec1 = get_vector_of_geo<Weighted_point_2>(*p1);
     auto vec2 = get_vector_of_geo<Weighted_point_2>(*p2);
@@ -114,7 +117,7 @@ geometry_vector_base_p geometry_barycenter_4(geometry_vector_base_p p1, geometry
         result.push_back(Point_2::NA_value());
         continue;
       }
-      result.push_back(CGAL::barycenter(wp1.point(), wp1.weight(), wp2.point(), wp2.weight(), wp3.point(), wp3.weight(), wp4.point(), wp4.weight()));
+      result.push_back(snap_construction<Point_2>(barycenter_impl(wp1, wp2, wp3, wp4)));
     }
     return create_geometry_vector(result);
   } else {
@@ -137,7 +140,7 @@ geometry_vector_base_p geometry_barycenter_4(geometry_vector_base_p p1, geometry
         result.push_back(Point_3::NA_value());
         continue;
       }
-      result.push_back(CGAL::barycenter(wp1.point(), wp1.weight(), wp2.point(), wp2.weight(), wp3.point(), wp3.weight(), wp4.point(), wp4.weight()));
+      result.push_back(snap_construction<Point_3>(barycenter_impl(wp1, wp2, wp3, wp4)));
     }
     return create_geometry_vector(result);
   }
@@ -145,6 +148,7 @@ geometry_vector_base_p geometry_barycenter_4(geometry_vector_base_p p1, geometry
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_bisector(geometry_vector_base_p geo1, geometry_vector_base_p geo2) {
+  Profile_scope profile(__func__, geo1);
   size_t output_size = std::max(geo1->size(), geo2->size());
   if (geo1->dimensions() == 2) {
     std::vector<Line_2> result;
@@ -217,6 +221,7 @@ geometry_vector_base_p geometry_bisector(geometry_vector_base_p geo1, geometry_v
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_centroid_1(geometry_vector_base_p geo) {
+  Profile_scope profile(__func__, geo);
   switch (geo->geometry_type()) {
   case TRIANGLE: {
     if (geo->dimensions() == 2) {
@@ -264,6 +269,7 @@ geometry_vector_base_p geometry_centroid_1(geometry_vector_base_p geo) {
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_centroid_3(geometry_vector_base_p p1, geometry_vector_base_p p2, geometry_vector_base_p p3) {
+  Profile_scope profile(__func__, p1);
   if (p1->dimensions() == 2) {
     auto vec1 = get_vector_of_geo<Point_2>(*p1);
     auto vec2 = get_vector_of_geo<Point_2>(*p2);
@@ -311,6 +317,7 @@ geometry_vector_base_p geometry_centroid_3(geometry_vector_base_p p1, geometry_v
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_centroid_4(geometry_vector_base_p p1, geometry_vector_base_p p2, geometry_vector_base_p p3, geometry_vector_base_p p4) {
+  Profile_scope profile(__func__, p1);
   if (p1->dimensions() == 2) {
     auto vec1 = get_vector_of_geo<Point_2>(*p1);
     auto vec2 = get_vector_of_geo<Point_2>(*p2);
@@ -362,6 +369,7 @@ geometry_vector_base_p geometry_centroid_4(geometry_vector_base_p p1, geometry_v
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_equidistant_line(point3_p p1, point3_p p2, point3_p p3) {
+  Profile_scope profile(__func__, p1);
   size_t output_size = std::max(std::max(p1->size(), p2->size()), p3->size());
   std::vector<Line_3> result;
   if (p1->size() == 0 || p2->size() == 0 || p3->size() == 0) {
@@ -381,6 +389,7 @@ geometry_vector_base_p geometry_equidistant_line(point3_p p1, point3_p p2, point
 
 [[cpp11::register]]
 geometry_vector_base_p geometry_radical_geometry(geometry_vector_base_p geo1, geometry_vector_base_p geo2) {
+  Profile_scope profile(__func__, geo1);
   size_t output_size = std::max(geo1->size(), geo2->size());
   if (geo1->geometry_type() == SPHERE) {
     auto s1 = get_vector_of_geo<Sphere>(*geo1);
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <vector>
+#include "cgal_types.h"
+
+// Forcing the exact value of a lazy object replaces its construction history
+// with the exact result, releasing all intermediate values that are not
+// referenced elsewhere
+
+template<typename T>
+inline void materialize_impl(const T& x) {
+  if (!x) {
+    return;
+  }
+  x.exact();
+}
+
+template<typename T>
+inline void materialize_transform(const T& x, int dim) {
+  if (!x) {
+    return;
+  }
+  for (int i = 0; i < dim; ++i) {
+    for (int j = 0; j <= dim; ++j) {
+      x.m(i, j).exact();
+    }
+  }
+  x.m(dim, dim).exact();
+}
+template<>
+inline void materialize_impl(const Aff_transformation_2& x) {
+  materialize_transform(x, 2);
+}
+template<>
+inline void materialize_impl(const Aff_transformation_3& x) {
+  materialize_transform(x, 3);
+}
+
+// Number of input elements a partial result of a cumulative operation must
+// span before it is materialized. 0 turns automatic materialisation off
+inline size_t& materialize_depth() {
+  static size_t depth = 0;
+  return depth;
+}
+
+// Level hook for tree_scan(). Materializing every level from the first one
+// reaching the depth means no result holds a history of more than roughly
+// `depth` operations, at the cost of O(n / depth) exact evaluations
+template<typename T>
+inline void auto_materialize_level(const std::vector<T>& level, size_t span) {
+  size_t depth = materialize_depth();
+  if (depth == 0 || span < depth) {
+    return;
+  }
+  for (size_t i = 0; i < level.size(); ++i) {
+    materialize_impl(level[i]);
+  }
+}
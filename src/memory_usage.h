@@ -0,0 +1,138 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <unordered_set>
+#include <cpp11/doubles.hpp>
+#include "cgal_types.h"
+
+#include <CGAL/Gmpq.h>
+#include <gmp.h>
+#ifdef CGAL_USE_GMPXX
+#include <gmpxx.h>
+#endif
+
+// Bytes held by an exact number type beyond its own footprint
+template<typename ET>
+inline size_t exact_bytes(const ET& x) {
+  return sizeof(ET);
+}
+inline size_t mpq_bytes(mpq_srcptr x) {
+  return sizeof(__mpq_struct) +
+    (mpz_size(mpq_numref(x)) + mpz_size(mpq_denref(x))) * sizeof(mp_limb_t);
+}
+inline size_t exact_bytes(const CGAL::Gmpq& x) {
+  return mpq_bytes(x.mpq());
+}
+#ifdef CGAL_USE_GMPXX
+inline size_t exact_bytes(const mpq_class& x) {
+  return mpq_bytes(x.get_mpq_t());
+}
+#endif
+
+// Bit lengths of the numerator and denominator of an exact rational. Returns
+// false if the exact number type is not a GMP rational
+template<typename ET>
+inline bool exact_bit_length(const ET& x, int& numerator, int& denominator) {
+  return false;
+}
+inline bool mpq_bit_length(mpq_srcptr x, int& numerator, int& denominator) {
+  numerator = mpz_sizeinbase(mpq_numref(x), 2);
+  denominator = mpz_sizeinbase(mpq_denref(x), 2);
+  return true;
+}
+inline bool exact_bit_length(const CGAL::Gmpq& x, int& numerator, int& denominator) {
+  return mpq_bit_length(x.mpq(), numerator, denominator);
+}
+#ifdef CGAL_USE_GMPXX
+inline bool exact_bit_length(const mpq_class& x, int& numerator, int& denominator) {
+  return mpq_bit_length(x.get_mpq_t(), numerator, denominator);
+}
+#endif
+
+// Tracks the largest numerator and denominator among a set of numbers
+struct Bit_length {
+  int numerator = 0;
+  int denominator = 0;
+  bool valid = false;
+
+  void add(const Kernel::FT& x) {
+    int num, den;
+    if (!exact_bit_length(x.exact(), num, den)) {
+      return;
+    }
+    numerator = std::max(numerator, num);
+    denominator = std::max(denominator, den);
+    valid = true;
+  }
+  int max() const {
+    return valid ? std::max(numerator, denominator) : R_NaInt;
+  }
+};
+
+// Accumulates the memory held by the elements of a vector. Lazy values are
+// handles to shared representations, so each representation is only counted
+// once. The construction history below a representation is not reachable and
+// is thus not included. Representations are counted with the size of their
+// base class since the concrete node type is not known, so storage is a lower
+// bound. Exact values are only measured for representations holding them, and
+// are never computed in order to be measured
+class Memory_usage {
+  std::unordered_set<const void*> _seen;
+  bool _exact_handle = false;
+
+public:
+  double storage = 0;
+  double nodes = 0;
+  double exact = 0;
+  double exact_bytes = 0;
+
+  Memory_usage(size_t n, size_t element_size) : storage(n * element_size) {}
+
+  // Registers a lazy handle. Returns true if the representation is new and its
+  // exact value has been computed
+  template<typename T>
+  bool add_handle(const T& x) {
+    _exact_handle = false;
+    if (!_seen.insert(static_cast<const void*>(x.ptr())).second) {
+      return false;
+    }
+    nodes += 1;
+    storage += sizeof(*x.ptr());
+    if (x.ptr()->is_lazy()) {
+      return false;
+    }
+    exact += 1;
+    _exact_handle = true;
+    return true;
+  }
+  void add_number(const Kernel::FT& x) {
+    if (add_handle(x)) {
+      exact_bytes += ::exact_bytes(x.exact());
+    }
+  }
+  // Adds a number obtained from an accessor returning by value. Numbers that
+  // the accessor creates on the fly (e.g. the constant entries of a
+  // translation matrix) are not held by the vector and are skipped. Counting
+  // them would also register the address of a representation that is freed
+  // right after, which a later temporary could reuse
+  void add_accessed_number(const Kernel::FT& x) {
+    if (x.refs() > 1) {
+      add_number(x);
+    }
+  }
+  // Adds the exact values of numbers derived from the geometry last passed to
+  // add_handle(). This is only done if the geometry holds its exact value, in
+  // which case the exact value of a derived number is read off it rather than
+  // computed from a construction history
+  void add_derived_number(const Kernel::FT& x) {
+    if (!_exact_handle) {
+      return;
+    }
+    exact_bytes += ::exact_bytes(x.exact());
+  }
+
+  cpp11::writable::doubles as_doubles() const {
+    return {storage, nodes, exact, exact_bytes};
+  }
+};
@@ -0,0 +1,83 @@
+#include "cgal_types.h"
+#include "geometry_vector.h"
+#include "grouping.h"
+
+#include <cpp11/integers.hpp>
+#include <cpp11/external_pointer.hpp>
+
+#include <CGAL/Random.h>
+#include <CGAL/Min_circle_2.h>
+#include <CGAL/Min_circle_2_traits_2.h>
+#include <CGAL/Min_sphere_d.h>
+#include <CGAL/Min_sphere_annulus_d_traits_3.h>
+
+typedef CGAL::Min_circle_2< CGAL::Min_circle_2_traits_2<Kernel> > Min_circle;
+typedef CGAL::Min_sphere_d< CGAL::Min_sphere_annulus_d_traits_3<Kernel> > Min_sphere;
+
+template<typename Point, typename T>
+inline std::vector<Point> valid_group_points(const std::vector<T>& points, const std::vector<int>& group) {
+  std::vector<Point> result;
+  result.reserve(group.size());
+  for (auto iter = group.begin(); iter != group.end(); ++iter) {
+    if (!points[*iter]) {
+      continue;
+    }
+    result.push_back(points[*iter]);
+  }
+  return result;
+}
+
+// Both algorithms are randomised incremental constructions that only have
+// expected linear runtime if the points are visited in random order. A fixed
+// seed is used so results are reproducible
+template<typename Point>
+inline void shuffle_points(std::vector<Point>& points, CGAL::Random& rng) {
+  for (size_t i = points.size(); i > 1; --i) {
+    std::swap(points[i - 1], points[rng.get_int(0, i)]);
+  }
+}
+
+[[cpp11::register]]
+geometry_vector_base_p geometry_min_enclosing(geometry_vector_base_p points, cpp11::integers group) {
+  Profile_scope profile(__func__, points);
+  if (points.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  if (points->geometry_type() != POINT) {
+    cpp11::stop("Minimum enclosing circles and spheres can only be calculated for points");
+  }
+  std::vector< std::vector<int> > groups = split_groups(group, points->size());
+  CGAL::Random rng(42);
+
+  if (points->dimensions() == 2) {
+    std::vector<Point_2> vec = get_vector_of_geo<Point_2>(*points);
+    std::vector<Circle_2> result;
+    result.reserve(groups.size());
+    for (size_t i = 0; i < groups.size(); ++i) {
+      std::vector<Kernel::Point_2> group_points = valid_group_points<Kernel::Point_2>(vec, groups[i]);
+      if (group_points.empty()) {
+        result.push_back(Circle_2::NA_value());
+        continue;
+      }
+      shuffle_points(group_points, rng);
+      Min_circle mc(group_points.begin(), group_points.end(), false);
+      result.emplace_back(mc.circle().center(), mc.circle().squared_radius());
+    }
+    return create_geometry_vector(result);
+  }
+
+  std::vector<Point_3> vec = get_vector_of_geo<Point_3>(*points);
+  std::vector<Sphere> result;
+  result.reserve(groups.size());
+  for (size_t i = 0; i < groups.size(); ++i) {
+    std::vector<Kernel::Point_3> group_points = valid_group_points<Kernel::Point_3>(vec, groups[i]);
+    if (group_points.empty()) {
+      result.push_back(Sphere::NA_value());
+      continue;
+    }
+    shuffle_points(group_points, rng);
+    Min_sphere ms(group_points.begin(), group_points.end());
+    result.emplace_back(ms.center(), ms.squared_radius());
+  }
+  return create_geometry_vector(result);
+}
@@ -0,0 +1,434 @@
+#pragma once
+
+#include <cpp11/logicals.hpp>
+#include <cpp11/integers.hpp>
+#include "cgal_types.h"
+#include "is_degenerate.h"
+
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/intersections.h>
+
+// Coordinate mirrors ----------------------------------------------------------
+//
+// Most geometries are created directly from R doubles and never pass through a
+// construction, yet all predicates on them go through the lazy exact number
+// type. Geometry vectors therefore lazily build a mirror of their vertices the
+// first time a predicate asks for it, using the cheapest representation that
+// holds all coordinates exactly:
+//
+// - If all coordinates are integers within the 32bit range (e.g. data snapped
+//   to a grid) they are stored as such and predicates are evaluated in 128bit
+//   integer arithmetic, as differences of coordinates need 33 bits.
+// - Otherwise, if all coordinates are exactly representable as doubles, they
+//   are stored as doubles and predicates are evaluated with the statically
+//   filtered predicates of Epick, which are exact for double input.
+//
+// Whether a coordinate qualifies is decided from its interval approximation
+// so building the mirror never forces an exact computation. The mirror is a
+// predicate acceleration cache held in addition to the exact storage, costing
+// 4 (grid) or 8 (double) bytes per coordinate while it is alive. It is not a
+// separate storage type, so constructions always use the exact representation
+// and nothing needs to be promoted.
+
+#if defined(__SIZEOF_INT128__)
+typedef __int128 grid_int;
+const bool grid_available = true;
+#else
+typedef int64_t grid_int;
+const bool grid_available = false;
+#endif
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Double_kernel;
+typedef Double_kernel::Point_2 Double_point_2;
+typedef Double_kernel::Point_3 Double_point_3;
+
+struct Grid_point_2 {
+  int32_t x;
+  int32_t y;
+};
+struct Grid_point_3 {
+  int32_t x;
+  int32_t y;
+  int32_t z;
+};
+
+// Same lexicographic ordering as the kernel points
+inline int mirror_compare(const Grid_point_2& p, const Grid_point_2& q) {
+  if (p.x != q.x) return p.x < q.x ? -1 : 1;
+  if (p.y != q.y) return p.y < q.y ? -1 : 1;
+  return 0;
+}
+inline int mirror_compare(const Grid_point_3& p, const Grid_point_3& q) {
+  if (p.x != q.x) return p.x < q.x ? -1 : 1;
+  if (p.y != q.y) return p.y < q.y ? -1 : 1;
+  if (p.z != q.z) return p.z < q.z ? -1 : 1;
+  return 0;
+}
+inline int mirror_compare(const Double_point_2& p, const Double_point_2& q) {
+  return CGAL::compare_xy(p, q);
+}
+inline int mirror_compare(const Double_point_3& p, const Double_point_3& q) {
+  return CGAL::compare_xyz(p, q);
+}
+inline bool operator<(const Grid_point_2& p, const Grid_point_2& q) {
+  return mirror_compare(p, q) < 0;
+}
+inline bool operator<(const Grid_point_3& p, const Grid_point_3& q) {
+  return mirror_compare(p, q) < 0;
+}
+
+// Conversion ------------------------------------------------------------------
+
+inline bool to_grid(const Kernel::FT& val, int32_t& out) {
+  std::pair<double, double> range = CGAL::to_interval(val);
+  if (range.first != range.second) {
+    return false;
+  }
+  double v = range.first;
+  if (!(v >= -2147483648.0 && v <= 2147483647.0) || v != std::floor(v)) {
+    return false;
+  }
+  out = static_cast<int32_t>(v);
+  return true;
+}
+inline bool to_grid(const Kernel::Point_2& p, Grid_point_2& out) {
+  return to_grid(p.x(), out.x) && to_grid(p.y(), out.y);
+}
+inline bool to_grid(const Kernel::Point_3& p, Grid_point_3& out) {
+  return to_grid(p.x(), out.x) && to_grid(p.y(), out.y) && to_grid(p.z(), out.z);
+}
+
+inline bool to_double_exact(const Kernel::FT& val, double& out) {
+  std::pair<double, double> range = CGAL::to_interval(val);
+  if (range.first != range.second || !std::isfinite(range.first)) {
+    return false;
+  }
+  out = range.first;
+  return true;
+}
+inline bool to_double_exact(const Kernel::Point_2& p, Double_point_2& out) {
+  double x, y;
+  if (!to_double_exact(p.x(), x) || !to_double_exact(p.y(), y)) {
+    return false;
+  }
+  out = Double_point_2(x, y);
+  return true;
+}
+inline bool to_double_exact(const Kernel::Point_3& p, Double_point_3& out) {
+  double x, y, z;
+  if (!to_double_exact(p.x(), x) || !to_double_exact(p.y(), y) || !to_double_exact(p.z(), z)) {
+    return false;
+  }
+  out = Double_point_3(x, y, z);
+  return true;
+}
+
+inline Double_point_2 grid_to_double(const Grid_point_2& p) {
+  return Double_point_2(p.x, p.y);
+}
+inline Double_point_3 grid_to_double(const Grid_point_3& p) {
+  return Double_point_3(p.x, p.y, p.z);
+}
+
+// Describes how the vertices of a geometry are laid out in the mirror. Types
+// without a layout never gets a mirror
+template<typename T>
+struct Mirror_layout {
+  typedef Grid_point_2 Grid_point;
+  typedef Double_point_2 Double_point;
+  static const size_t n = 0;
+  static Kernel::Point_2 vertex(const T& geo, size_t i) { return Kernel::Point_2(); }
+};
+template<>
+struct Mirror_layout<Point_2> {
+  typedef Grid_point_2 Grid_point;
+  typedef Double_point_2 Double_point;
+  static const size_t n = 1;
+  static Kernel::Point_2 vertex(const Point_2& geo, size_t i) { return geo; }
+};
+template<>
+struct Mirror_layout<Point_3> {
+  typedef Grid_point_3 Grid_point;
+  typedef Double_point_3 Double_point;
+  static const size_t n = 1;
+  static Kernel::Point_3 vertex(const Point_3& geo, size_t i) { return geo; }
+};
+template<>
+struct Mirror_layout<Segment_2> {
+  typedef Grid_point_2 Grid_point;
+  typedef Double_point_2 Double_point;
+  static const size_t n = 2;
+  static Kernel::Point_2 vertex(const Segment_2& geo, size_t i) { return geo.vertex(i); }
+};
+template<>
+struct Mirror_layout<Triangle_2> {
+  typedef Grid_point_2 Grid_point;
+  typedef Double_point_2 Double_point;
+  static const size_t n = 3;
+  static Kernel::Point_2 vertex(const Triangle_2& geo, size_t i) { return geo.vertex(i); }
+};
+
+// The mirrors predicates may use, read from the internal `euclid.mirror_level`
+// option: 2 (the default) allows grid and double mirrors, 1 only double
+// mirrors, and 0 turns mirrors off so all predicates use the kernel. Used for
+// comparing the fast paths against the kernel
+inline int mirror_level() {
+  static SEXP option = Rf_install("euclid.mirror_level");
+  SEXP level = Rf_GetOption1(option);
+  if (Rf_isNull(level)) {
+    return 2;
+  }
+  int value = Rf_asInteger(level);
+  return value == NA_INTEGER ? 2 : value;
+}
+
+enum Mirror_state {
+  MIRROR_UNKNOWN,
+  MIRROR_NONE,
+  MIRROR_DOUBLE,
+  MIRROR_GRID
+};
+
+template<typename T>
+class Coordinate_mirror {
+  typedef Mirror_layout<T> Layout;
+  typedef typename Layout::Grid_point Grid_point;
+  typedef typename Layout::Double_point Double_point;
+
+  mutable Mirror_state _state = MIRROR_UNKNOWN;
+  mutable int _level = -1;
+  mutable std::vector<Grid_point> _grid;
+  mutable std::vector<Double_point> _doubles;
+
+  // Builds the mirror unless it has already been built at the current level
+  void update(const std::vector<T>& storage) const {
+    int level = mirror_level();
+    if (_state != MIRROR_UNKNOWN && _level == level) {
+      return;
+    }
+    reset();
+    _level = level;
+    if (Layout::n == 0 || level == 0) {
+      _state = MIRROR_NONE;
+      return;
+    }
+    bool on_grid = grid_available && level > 1;
+    bool on_double = true;
+    _grid.assign(on_grid ? storage.size() * Layout::n : 0, Grid_point());
+    _doubles.assign(storage.size() * Layout::n, Double_point(CGAL::ORIGIN));
+    for (size_t i = 0; i < storage.size() && (on_grid || on_double); ++i) {
+      if (!storage[i]) {
+        continue;
+      }
+      for (size_t j = 0; j < Layout::n; ++j) {
+        auto vert = Layout::vertex(storage[i], j);
+        size_t k = i * Layout::n + j;
+        on_grid = on_grid && to_grid(vert, _grid[k]);
+        on_double = on_double && to_double_exact(vert, _doubles[k]);
+      }
+    }
+    // The double mirror of grid coordinates is cheap to recreate on demand
+    if (on_grid || !on_double) {
+      std::vector<Double_point>().swap(_doubles);
+    }
+    if (!on_grid) {
+      std::vector<Grid_point>().swap(_grid);
+    }
+    _state = on_grid ? MIRROR_GRID : (on_double ? MIRROR_DOUBLE : MIRROR_NONE);
+  }
+
+public:
+  // Must be called whenever the storage the mirror is built from changes
+  void reset() const {
+    _state = MIRROR_UNKNOWN;
+    std::vector<Grid_point>().swap(_grid);
+    std::vector<Double_point>().swap(_doubles);
+  }
+  // Returns the grid coordinates of all vertices, with the vertices of element
+  // i starting at i * n, or nullptr if any valid element has a vertex off the
+  // grid. NA elements are stored as the origin and must be checked by the
+  // caller
+  const std::vector<Grid_point>* grid(const std::vector<T>& storage) const {
+    update(storage);
+    return _state == MIRROR_GRID ? &_grid : nullptr;
+  }
+  // As above but with the coordinates as doubles, which is available for all
+  // vectors with a grid mirror as well
+  const std::vector<Double_point>* doubles(const std::vector<T>& storage) const {
+    update(storage);
+    if (_state == MIRROR_GRID && _doubles.size() != _grid.size()) {
+      _doubles.clear();
+      _doubles.reserve(_grid.size());
+      for (auto iter = _grid.begin(); iter != _grid.end(); ++iter) {
+        _doubles.push_back(grid_to_double(*iter));
+      }
+    }
+    return _state == MIRROR_NONE ? nullptr : &_doubles;
+  }
+};
+
+// Predicates ------------------------------------------------------------------
+
+inline int grid_orientation(const Grid_point_2& p, const Grid_point_2& q, const Grid_point_2& r) {
+  grid_int det = grid_int(int64_t(q.x) - p.x) * (int64_t(r.y) - p.y) -
+    grid_int(int64_t(q.y) - p.y) * (int64_t(r.x) - p.x);
+  return det > 0 ? 1 : (det < 0 ? -1 : 0);
+}
+
+// Assumes r is collinear with p and q
+inline bool grid_between(const Grid_point_2& p, const Grid_point_2& q, const Grid_point_2& r) {
+  return std::min(p.x, q.x) <= r.x && r.x <= std::max(p.x, q.x) &&
+    std::min(p.y, q.y) <= r.y && r.y <= std::max(p.y, q.y);
+}
+
+inline CGAL::Bounded_side grid_triangle_bounded_side(const Grid_point_2* t, const Grid_point_2& p) {
+  int o = grid_orientation(t[0], t[1], t[2]);
+  int o1 = o * grid_orientation(t[0], t[1], p);
+  int o2 = o * grid_orientation(t[1], t[2], p);
+  int o3 = o * grid_orientation(t[2], t[0], p);
+  if (o1 < 0 || o2 < 0 || o3 < 0) {
+    return CGAL::ON_UNBOUNDED_SIDE;
+  }
+  if (o1 == 0 || o2 == 0 || o3 == 0) {
+    return CGAL::ON_BOUNDARY;
+  }
+  return CGAL::ON_BOUNDED_SIDE;
+}
+
+// The predicates below are given the vertices of each geometry so they can be
+// applied directly to the mirrors. Degenerate geometries are never passed in
+
+struct Mirror_equal {
+  int operator()(const Grid_point_2* p, const Grid_point_2* q) const {
+    return mirror_compare(*p, *q) == 0;
+  }
+  int operator()(const Double_point_2* p, const Double_point_2* q) const {
+    return *p == *q;
+  }
+};
+struct Mirror_segment_has_on {
+  int operator()(const Grid_point_2* s, const Grid_point_2* p) const {
+    return grid_orientation(s[0], s[1], *p) == 0 && grid_between(s[0], s[1], *p);
+  }
+  int operator()(const Double_point_2* s, const Double_point_2* p) const {
+    return CGAL::collinear(s[0], s[1], *p) && CGAL::collinear_are_ordered_along_line(s[0], *p, s[1]);
+  }
+};
+struct Mirror_segments_intersect {
+  int operator()(const Grid_point_2* s1, const Grid_point_2* s2) const {
+    int o1 = grid_orientation(s1[0], s1[1], s2[0]);
+    int o2 = grid_orientation(s1[0], s1[1], s2[1]);
+    int o3 = grid_orientation(s2[0], s2[1], s1[0]);
+    int o4 = grid_orientation(s2[0], s2[1], s1[1]);
+    if (o1 != o2 && o3 != o4) {
+      return true;
+    }
+    return (o1 == 0 && grid_between(s1[0], s1[1], s2[0])) ||
+      (o2 == 0 && grid_between(s1[0], s1[1], s2[1])) ||
+      (o3 == 0 && grid_between(s2[0], s2[1], s1[0])) ||
+      (o4 == 0 && grid_between(s2[0], s2[1], s1[1]));
+  }
+  int operator()(const Double_point_2* s1, const Double_point_2* s2) const {
+    return CGAL::do_intersect(Double_kernel::Segment_2(s1[0], s1[1]), Double_kernel::Segment_2(s2[0], s2[1]));
+  }
+};
+// Tests the side of the triangle a point falls on. With `negate` it tests the
+// point is not on the given side
+struct Mirror_triangle_side {
+  CGAL::Bounded_side side;
+  bool negate;
+
+  int operator()(const Grid_point_2* t, const Grid_point_2* p) const {
+    return (grid_triangle_bounded_side(t, *p) == side) != negate;
+  }
+  int operator()(const Double_point_2* t, const Double_point_2* p) const {
+    return (Double_kernel::Triangle_2(t[0], t[1], t[2]).bounded_side(*p) == side) != negate;
+  }
+};
+
+// Vectorised evaluation -------------------------------------------------------
+
+// Mirrors the recycling and NA handling of the kernel based predicates
+template<typename T, typename U, typename Mirror_point, typename Predicate>
+inline cpp11::writable::logicals mirror_predicate_impl(const std::vector<T>& geo1, const std::vector<Mirror_point>& mirror1,
+                                                       const std::vector<U>& geo2, const std::vector<Mirror_point>& mirror2,
+                                                       const Predicate& predicate) {
+  if (geo1.size() == 0 || geo2.size() == 0) {
+    return {};
+  }
+  size_t output_size = std::max(geo1.size(), geo2.size());
+  cpp11::writable::logicals result;
+  result.reserve(output_size);
+  for (size_t i = 0; i < output_size; ++i) {
+    size_t i1 = i % geo1.size();
+    size_t i2 = i % geo2.size();
+    if (invalid_geo(geo1[i1]) || invalid_geo(geo2[i2])) {
+      result.push_back(NA_LOGICAL);
+      continue;
+    }
+    int res = predicate(&mirror1[i1 * Mirror_layout<T>::n], &mirror2[i2 * Mirror_layout<U>::n]);
+    result.push_back((Rboolean) res);
+  }
+  return result;
+}
+
+template<typename Mirror_point>
+struct Mirror_index_less {
+  const std::vector<Mirror_point>& mirror;
+  bool decreasing;
+  bool operator()(size_t a, size_t b) const {
+    return decreasing ? mirror_compare(mirror[b], mirror[a]) < 0 : mirror_compare(mirror[a], mirror[b]) < 0;
+  }
+};
+
+// Stable ordering of the valid points, with NA points removed
+template<typename T, typename Mirror_point>
+inline std::vector<size_t> mirror_order_impl(const std::vector<T>& points, const std::vector<Mirror_point>& mirror, bool decreasing) {
+  std::vector<size_t> order;
+  order.reserve(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (points[i]) {
+      order.push_back(i);
+    }
+  }
+  Mirror_index_less<Mirror_point> less = {mirror, decreasing};
+  std::stable_sort(order.begin(), order.end(), less);
+  return order;
+}
+
+template<typename T, typename Mirror_point>
+inline cpp11::writable::integers mirror_match_impl(const std::vector<T>& x, const std::vector<Mirror_point>& x_mirror,
+                                                   const std::vector<T>& lookup, const std::vector<Mirror_point>& lookup_mirror) {
+  std::map<Mirror_point, size_t> lookup_map;
+
+  int NA_ind = -1;
+  for (size_t i = 0; i < lookup.size(); ++i) {
+    if (!lookup[i]) {
+      if (NA_ind == -1) NA_ind = i;
+      continue;
+    }
+    lookup_map.insert(std::make_pair(lookup_mirror[i], i));
+  }
+  cpp11::writable::integers results;
+  results.reserve(x.size());
+  for (size_t i = 0; i < x.size(); ++i) {
+    if (!x[i]) {
+      results.push_back(NA_ind == -1 ? R_NaInt : NA_ind + 1);
+      continue;
+    }
+    auto match = lookup_map.find(x_mirror[i]);
+    if (match == lookup_map.end()) {
+      results.push_back(R_NaInt);
+    } else {
+      results.push_back(match->second + 1);
+    }
+  }
+
+  return results;
+}
@@ -11,6 +11,7 @@
 
 [[cpp11::register]]
 plane_p create_plane_empty() {
+  Profile_scope profile(__func__);
   std::vector<Plane> vec;
   plane *result(new plane(vec));
   return {result};
@@ -18,6 +19,7 @@ plane_p create_plane_empty() {
 
 [[cpp11::register]]
 plane_p create_plane_abcd(exact_numeric_p a, exact_numeric_p b, exact_numeric_p c, exact_numeric_p d) {
+  Profile_scope profile(__func__, a);
   std::vector<Plane> vec;
   vec.reserve(a->size());
   for (size_t i = 0; i < a->size(); ++i) {
@@ -34,6 +36,7 @@ plane_p create_plane_abcd(exact_numeric_p a, exact_numeric_p b, exact_numeric_p
 
 [[cpp11::register]]
 plane_p create_plane_pqr(point3_p p, point3_p q, point3_p r) {
+  Profile_scope profile(__func__, p);
   std::vector<Plane> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -50,6 +53,7 @@ plane_p create_plane_pqr(point3_p p, point3_p q, point3_p r) {
 
 [[cpp11::register]]
 plane_p create_plane_pv(point3_p p, vector3_p v) {
+  Profile_scope profile(__func__, p);
   std::vector<Plane> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -66,6 +70,7 @@ plane_p create_plane_pv(point3_p p, vector3_p v) {
 
 [[cpp11::register]]
 plane_p create_plane_pd(point3_p p, direction3_p d) {
+  Profile_scope profile(__func__, p);
   std::vector<Plane> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -82,6 +87,7 @@ plane_p create_plane_pd(point3_p p, direction3_p d) {
 
 [[cpp11::register]]
 plane_p create_plane_pl(point3_p p, line3_p l) {
+  Profile_scope profile(__func__, p);
   std::vector<Plane> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -98,6 +104,7 @@ plane_p create_plane_pl(point3_p p, line3_p l) {
 
 [[cpp11::register]]
 plane_p create_plane_pr(point3_p p, ray3_p r) {
+  Profile_scope profile(__func__, p);
   std::vector<Plane> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -114,6 +121,7 @@ plane_p create_plane_pr(point3_p p, ray3_p r) {
 
 [[cpp11::register]]
 plane_p create_plane_ps(point3_p p, segment3_p s) {
+  Profile_scope profile(__func__, p);
   std::vector<Plane> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -130,6 +138,7 @@ plane_p create_plane_ps(point3_p p, segment3_p s) {
 
 [[cpp11::register]]
 plane_p create_plane_circle(circle3_p circle) {
+  Profile_scope profile(__func__, circle);
   std::vector<Plane> vec;
   vec.reserve(circle->size());
   for (size_t i = 0; i < circle->size(); ++i) {
@@ -146,6 +155,7 @@ plane_p create_plane_circle(circle3_p circle) {
 
 [[cpp11::register]]
 plane_p create_plane_triangle(triangle3_p triangle) {
+  Profile_scope profile(__func__, triangle);
   std::vector<Plane> vec;
   vec.reserve(triangle->size());
   for (size_t i = 0; i < triangle->size(); ++i) {
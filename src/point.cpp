@@ -9,6 +9,7 @@
 
 [[cpp11::register]]
 point2_p create_point_2_empty() {
+  Profile_scope profile(__func__);
   std::vector<Point_2> vec;
   point2 *result(new point2(vec));
   return {result};
@@ -16,6 +17,7 @@ point2_p create_point_2_empty() {
 
 [[cpp11::register]]
 point2_p create_point_2_x_y(exact_numeric_p x, exact_numeric_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_2> vec;
   vec.reserve(x->size());
   for (size_t i = 0; i < x->size(); ++i) {
@@ -32,6 +34,7 @@ point2_p create_point_2_x_y(exact_numeric_p x, exact_numeric_p y) {
 
 [[cpp11::register]]
 point2_p create_point_2_vec(vector2_p p) {
+  Profile_scope profile(__func__, p);
   std::vector<Point_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -48,6 +51,7 @@ point2_p create_point_2_vec(vector2_p p) {
 
 [[cpp11::register]]
 point2_p create_point_2_wp(point_w2_p p) {
+  Profile_scope profile(__func__, p);
   std::vector<Point_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -64,6 +68,7 @@ point2_p create_point_2_wp(point_w2_p p) {
 
 [[cpp11::register]]
 point2_p point_2_add_vector(point2_p x, vector2_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_2> vec = (*x) + y->get_storage();
   point2 *result(new point2(vec));
 
@@ -72,6 +77,7 @@ point2_p point_2_add_vector(point2_p x, vector2_p y) {
 
 [[cpp11::register]]
 point2_p point_2_sub_vector(point2_p x, vector2_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_2> vec = (*x) - y->get_storage();
   point2 *result(new point2(vec));
 
@@ -80,6 +86,7 @@ point2_p point_2_sub_vector(point2_p x, vector2_p y) {
 
 [[cpp11::register]]
 vector2_p point_2_sub_point(point2_p x, point2_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_2> vec = (*x) - y->get_storage();
   vector2 *result(new vector2(vec));
 
@@ -88,16 +95,21 @@ vector2_p point_2_sub_point(point2_p x, point2_p y) {
 
 [[cpp11::register]]
 cpp11::writable::logicals point_2_less(point2_p x, point2_p y) {
+  Profile_scope profile(__func__, x);
+  geometry_filter_tracker tracker("less", *x, *y);
   return (*x) < y->get_storage();
 }
 
 [[cpp11::register]]
 cpp11::writable::logicals point_2_greater(point2_p x, point2_p y) {
+  Profile_scope profile(__func__, x);
+  geometry_filter_tracker tracker("greater", *x, *y);
   return (*x) > y->get_storage();
 }
 
 [[cpp11::register]]
 point2_p point_2_sort(point2_p x, bool decreasing, cpp11::logicals na_last) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_2> vec = x->sort(decreasing, na_last);
   point2 *result(new point2(vec));
   return {result};
@@ -105,11 +117,13 @@ point2_p point_2_sort(point2_p x, bool decreasing, cpp11::logicals na_last) {
 
 [[cpp11::register]]
 cpp11::writable::integers point_2_rank(point2_p x) {
+  Profile_scope profile(__func__, x);
   return x->rank();
 }
 
 [[cpp11::register]]
 point2_p point_2_min(point2_p x, bool na_rm) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_2> vec = x->min(na_rm);
   point2 *result(new point2(vec));
   return {result};
@@ -117,6 +131,7 @@ point2_p point_2_min(point2_p x, bool na_rm) {
 
 [[cpp11::register]]
 point2_p point_2_max(point2_p x, bool na_rm) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_2> vec = x->max(na_rm);
   point2 *result(new point2(vec));
   return {result};
@@ -124,6 +139,7 @@ point2_p point_2_max(point2_p x, bool na_rm) {
 
 [[cpp11::register]]
 point2_p point_2_cummin(point2_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_2> vec = x->cummin();
   point2 *result(new point2(vec));
   return {result};
@@ -131,6 +147,7 @@ point2_p point_2_cummin(point2_p x) {
 
 [[cpp11::register]]
 point2_p point_2_cummax(point2_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_2> vec = x->cummax();
   point2 *result(new point2(vec));
   return {result};
@@ -138,6 +155,7 @@ point2_p point_2_cummax(point2_p x) {
 
 [[cpp11::register]]
 point3_p create_point_3_empty() {
+  Profile_scope profile(__func__);
   std::vector<Point_3> vec;
   point3 *result(new point3(vec));
   return {result};
@@ -145,6 +163,7 @@ point3_p create_point_3_empty() {
 
 [[cpp11::register]]
 point3_p create_point_3_x_y_z(exact_numeric_p x, exact_numeric_p y, exact_numeric_p z) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_3> vec;
   vec.reserve(x->size());
   for (size_t i = 0; i < x->size(); ++i) {
@@ -161,6 +180,7 @@ point3_p create_point_3_x_y_z(exact_numeric_p x, exact_numeric_p y, exact_numeri
 
 [[cpp11::register]]
 point3_p create_point_3_vec(vector3_p p) {
+  Profile_scope profile(__func__, p);
   std::vector<Point_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -177,6 +197,7 @@ point3_p create_point_3_vec(vector3_p p) {
 
 [[cpp11::register]]
 point3_p create_point_3_wp(point_w3_p p) {
+  Profile_scope profile(__func__, p);
   std::vector<Point_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -193,6 +214,7 @@ point3_p create_point_3_wp(point_w3_p p) {
 
 [[cpp11::register]]
 point3_p point_3_add_vector(point3_p x, vector3_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_3> vec = (*x) + y->get_storage();
   point3 *result(new point3(vec));
 
@@ -201,6 +223,7 @@ point3_p point_3_add_vector(point3_p x, vector3_p y) {
 
 [[cpp11::register]]
 point3_p point_3_sub_vector(point3_p x, vector3_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_3> vec = (*x) - y->get_storage();
   point3 *result(new point3(vec));
 
@@ -209,6 +232,7 @@ point3_p point_3_sub_vector(point3_p x, vector3_p y) {
 
 [[cpp11::register]]
 vector3_p point_3_sub_point(point3_p x, point3_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_3> vec = (*x) - y->get_storage();
   vector3 *result(new vector3(vec));
 
@@ -217,16 +241,21 @@ vector3_p point_3_sub_point(point3_p x, point3_p y) {
 
 [[cpp11::register]]
 cpp11::writable::logicals point_3_less(point3_p x, point3_p y) {
+  Profile_scope profile(__func__, x);
+  geometry_filter_tracker tracker("less", *x, *y);
   return (*x) < y->get_storage();
 }
 
 [[cpp11::register]]
 cpp11::writable::logicals point_3_greater(point3_p x, point3_p y) {
+  Profile_scope profile(__func__, x);
+  geometry_filter_tracker tracker("greater", *x, *y);
   return (*x) > y->get_storage();
 }
 
 [[cpp11::register]]
 point3_p point_3_sort(point3_p x, bool decreasing, cpp11::logicals na_last) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_3> vec = x->sort(decreasing, na_last);
   point3 *result(new point3(vec));
   return {result};
@@ -234,11 +263,13 @@ point3_p point_3_sort(point3_p x, bool decreasing, cpp11::logicals na_last) {
 
 [[cpp11::register]]
 cpp11::writable::integers point_3_rank(point3_p x) {
+  Profile_scope profile(__func__, x);
   return x->rank();
 }
 
 [[cpp11::register]]
 point3_p point_3_min(point3_p x, bool na_rm) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_3> vec = x->min(na_rm);
   point3 *result(new point3(vec));
   return {result};
@@ -246,6 +277,7 @@ point3_p point_3_min(point3_p x, bool na_rm) {
 
 [[cpp11::register]]
 point3_p point_3_max(point3_p x, bool na_rm) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_3> vec = x->max(na_rm);
   point3 *result(new point3(vec));
   return {result};
@@ -253,6 +285,7 @@ point3_p point_3_max(point3_p x, bool na_rm) {
 
 [[cpp11::register]]
 point3_p point_3_cummin(point3_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_3> vec = x->cummin();
   point3 *result(new point3(vec));
   return {result};
@@ -260,6 +293,7 @@ point3_p point_3_cummin(point3_p x) {
 
 [[cpp11::register]]
 point3_p point_3_cummax(point3_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Point_3> vec = x->cummax();
   point3 *result(new point3(vec));
   return {result};
@@ -267,6 +301,7 @@ point3_p point_3_cummax(point3_p x) {
 
 [[cpp11::register]]
 cpp11::writable::logicals point_collinear(geometry_vector_base_p x, geometry_vector_base_p y, geometry_vector_base_p z) {
+  Profile_scope profile(__func__, x);
   if (x->size() == 0 || y->size() == 0 || z->size() == 0) {
     return {};
   }
@@ -301,6 +336,7 @@ cpp11::writable::logicals point_collinear(geometry_vector_base_p x, geometry_vec
 
 [[cpp11::register]]
 cpp11::writable::logicals point_coplanar(point3_p x, point3_p y, point3_p z, point3_p t) {
+  Profile_scope profile(__func__, x);
   if (x->size() == 0 || y->size() == 0 || z->size() == 0 || t->size() == 0) {
     return {};
   }
@@ -319,6 +355,7 @@ cpp11::writable::logicals point_coplanar(point3_p x, point3_p y, point3_p z, poi
 
 [[cpp11::register]]
 cpp11::writable::logicals point_ordered(geometry_vector_base_p x, geometry_vector_base_p y, geometry_vector_base_p z) {
+  Profile_scope profile(__func__, x);
   if (x->size() == 0 || y->size() == 0 || z->size() == 0) {
     return {};
   }
@@ -353,6 +390,7 @@ cpp11::writable::logicals point_ordered(geometry_vector_base_p x, geometry_vecto
 
 [[cpp11::register]]
 cpp11::writable::logicals point_ordered_along(geometry_vector_base_p x) {
+  Profile_scope profile(__func__, x);
   if (x->size() < 3) {
     return {};
   }
@@ -388,6 +426,7 @@ cpp11::writable::logicals point_ordered_along(geometry_vector_base_p x) {
 
 [[cpp11::register]]
 cpp11::writable::logicals point_turns_left(point2_p x, point2_p y, point2_p z) {
+  Profile_scope profile(__func__, x);
   if (x->size() == 0 || y->size() == 0 || z->size() == 0) {
     return {};
   }
@@ -406,6 +445,7 @@ cpp11::writable::logicals point_turns_left(point2_p x, point2_p y, point2_p z) {
 
 [[cpp11::register]]
 cpp11::writable::logicals point_turns_right(point2_p x, point2_p y, point2_p z) {
+  Profile_scope profile(__func__, x);
   if (x->size() == 0 || y->size() == 0 || z->size() == 0) {
     return {};
   }
@@ -424,6 +464,7 @@ cpp11::writable::logicals point_turns_right(point2_p x, point2_p y, point2_p z)
 
 [[cpp11::register]]
 cpp11::writable::integers point_turns(point2_p x) {
+  Profile_scope profile(__func__, x);
   if (x->size() < 3) {
     return {};
   }
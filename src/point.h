@@ -59,10 +59,31 @@ public:
     case CIRCLE: return do_intersect_impl(get_vector_of_geo<Circle_2>(other), _storage);
     case ISORECT: return do_intersect_impl(get_vector_of_geo<Iso_rectangle>(other), _storage);
     case LINE: return do_intersect_impl(get_vector_of_geo<Line_2>(other), _storage);
-    case POINT: return do_intersect_impl(_storage, get_vector_of_geo<Point_2>(other));
+    case POINT: {
+      bool handled;
+      cpp11::writable::logicals result = mirror_predicate<Point_2, Point_2>(*this, other, Mirror_equal(), handled);
+      if (handled) {
+        return result;
+      }
+      return do_intersect_impl(_storage, get_vector_of_geo<Point_2>(other));
+    }
     case RAY: return do_intersect_impl(_storage, get_vector_of_geo<Ray_2>(other));
-    case SEGMENT: return do_intersect_impl(_storage, get_vector_of_geo<Segment_2>(other));
-    case TRIANGLE: return do_intersect_impl(_storage, get_vector_of_geo<Triangle_2>(other));
+    case SEGMENT: {
+      bool handled;
+      cpp11::writable::logicals result = mirror_predicate<Segment_2, Point_2>(other, *this, Mirror_segment_has_on(), handled);
+      if (handled) {
+        return result;
+      }
+      return do_intersect_impl(_storage, get_vector_of_geo<Segment_2>(other));
+    }
+    case TRIANGLE: {
+      bool handled;
+      cpp11::writable::logicals result = mirror_predicate<Triangle_2, Point_2>(other, *this, Mirror_triangle_side{CGAL::ON_UNBOUNDED_SIDE, true}, handled);
+      if (handled) {
+        return result;
+      }
+      return do_intersect_impl(_storage, get_vector_of_geo<Triangle_2>(other));
+    }
     default: return unknown_intersect_impl(std::max(size(), other.size()));
     }
   }
@@ -182,7 +203,12 @@ public:
     int n_na = result.end() - end;
     result.resize(end - result.begin());
 
-    if (decreasing) {
+    std::vector<size_t> order;
+    if (mirror_order(decreasing, order)) {
+      for (size_t i = 0; i < order.size(); ++i) {
+        result[i] = _storage[order[i]];
+      }
+    } else if (decreasing) {
       std::stable_sort(result.begin(), result.end(), std::greater<Point_2>());
     } else {
       std::stable_sort(result.begin(), result.end());
@@ -200,6 +226,21 @@ public:
     return result;
   }
   cpp11::writable::integers rank() const {
+    std::vector<size_t> order;
+    if (mirror_order(false, order)) {
+      cpp11::writable::integers result;
+      result.reserve(size());
+      for (auto iter = order.begin(); iter != order.end(); ++iter) {
+        result.push_back(*iter + 1);
+      }
+      for (size_t i = 0; i < size(); ++i) {
+        if (!_storage[i]) {
+          result.push_back(i + 1);
+        }
+      }
+      return result;
+    }
+
     std::vector< std::pair<Point_2, size_t> > ranks;
     ranks.reserve(size());
 
@@ -262,6 +303,8 @@ public:
 
     return {maximum};
   }
+  // Serial scans, as running extremes only select among the input points and
+  // construct nothing (see exact_numeric::cummax())
   std::vector<Point_2> cummin() const {
     std::vector<Point_2> result;
     result.reserve(size());
@@ -305,7 +348,7 @@ public:
         cum_max = Point_2::NA_value();
       }
       if (!is_na) {
-        cum_max = _storage[i] < cum_max ? _storage[i] : cum_max;
+        cum_max = _storage[i] > cum_max ? _storage[i] : cum_max;
       }
       result.push_back(cum_max);
     }
@@ -498,7 +541,12 @@ public:
     int n_na = result.end() - end;
     result.resize(end - result.begin());
 
-    if (decreasing) {
+    std::vector<size_t> order;
+    if (mirror_order(decreasing, order)) {
+      for (size_t i = 0; i < order.size(); ++i) {
+        result[i] = _storage[order[i]];
+      }
+    } else if (decreasing) {
       std::stable_sort(result.begin(), result.end(), std::greater<Point_3>());
     } else {
       std::stable_sort(result.begin(), result.end());
@@ -516,6 +564,21 @@ public:
     return result;
   }
   cpp11::writable::integers rank() const {
+    std::vector<size_t> order;
+    if (mirror_order(false, order)) {
+      cpp11::writable::integers result;
+      result.reserve(size());
+      for (auto iter = order.begin(); iter != order.end(); ++iter) {
+        result.push_back(*iter + 1);
+      }
+      for (size_t i = 0; i < size(); ++i) {
+        if (!_storage[i]) {
+          result.push_back(i + 1);
+        }
+      }
+      return result;
+    }
+
     std::vector< std::pair<Point_3, size_t> > ranks;
     ranks.reserve(size());
 
@@ -578,6 +641,7 @@ public:
 
     return {maximum};
   }
+  // Serial scans, see point2::cummin()
   std::vector<Point_3> cummin() const {
     std::vector<Point_3> result;
     result.reserve(size());
@@ -621,7 +685,7 @@ public:
         cum_max = Point_3::NA_value();
       }
       if (!is_na) {
-        cum_max = _storage[i] < cum_max ? _storage[i] : cum_max;
+        cum_max = _storage[i] > cum_max ? _storage[i] : cum_max;
       }
       result.push_back(cum_max);
     }
@@ -6,6 +6,7 @@
 
 [[cpp11::register]]
 point_w2_p create_point_w_2_empty() {
+  Profile_scope profile(__func__);
   std::vector<Weighted_point_2> vec;
   point_w2 *result(new point_w2(vec));
   return {result};
@@ -13,6 +14,7 @@ point_w2_p create_point_w_2_empty() {
 
 [[cpp11::register]]
 point_w2_p create_point_w_2_x_y_w(exact_numeric_p x, exact_numeric_p y, exact_numeric_p w) {
+  Profile_scope profile(__func__, x);
   std::vector<Weighted_point_2> vec;
   vec.reserve(x->size());
   for (size_t i = 0; i < x->size(); ++i) {
@@ -29,6 +31,7 @@ point_w2_p create_point_w_2_x_y_w(exact_numeric_p x, exact_numeric_p y, exact_nu
 
 [[cpp11::register]]
 point_w2_p create_point_w_2_p_w(point2_p p, exact_numeric_p w) {
+  Profile_scope profile(__func__, p);
   std::vector<Weighted_point_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -45,6 +48,7 @@ point_w2_p create_point_w_2_p_w(point2_p p, exact_numeric_p w) {
 
 [[cpp11::register]]
 point_w3_p create_point_w_3_empty() {
+  Profile_scope profile(__func__);
   std::vector<Weighted_point_3> vec;
   point_w3 *result(new point_w3(vec));
   return {result};
@@ -52,6 +56,7 @@ point_w3_p create_point_w_3_empty() {
 
 [[cpp11::register]]
 point_w3_p create_point_w_3_x_y_z_w(exact_numeric_p x, exact_numeric_p y, exact_numeric_p z, exact_numeric_p w) {
+  Profile_scope profile(__func__, x);
   std::vector<Weighted_point_3> vec;
   vec.reserve(x->size());
   for (size_t i = 0; i < x->size(); ++i) {
@@ -68,6 +73,7 @@ point_w3_p create_point_w_3_x_y_z_w(exact_numeric_p x, exact_numeric_p y, exact_
 
 [[cpp11::register]]
 point_w3_p create_point_w_3_p_w(point3_p p, exact_numeric_p w) {
+  Profile_scope profile(__func__, p);
   std::vector<Weighted_point_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -0,0 +1,181 @@
+#include "cgal_types.h"
+#include "exact_numeric.h"
+#include "vector.h"
+#include "expansion.h"
+
+#include <cpp11/list_of.hpp>
+
+#include <vector>
+#include <algorithm>
+
+// Fused dot products, sums of products and determinants. See Fused_sum in
+// expansion.h
+
+inline void add_products(Fused_sum& sum, const Exact_number& a, const Exact_number& b) {
+  sum.add_product(a, b);
+}
+inline void add_products(Fused_sum& sum, const Vector_2& a, const Vector_2& b) {
+  sum.add_product(a.x(), b.x());
+  sum.add_product(a.y(), b.y());
+}
+inline void add_products(Fused_sum& sum, const Vector_3& a, const Vector_3& b) {
+  sum.add_product(a.x(), b.x());
+  sum.add_product(a.y(), b.y());
+  sum.add_product(a.z(), b.z());
+}
+
+template<typename T>
+inline Exact_number sum_of_products_impl(const std::vector<T>& x, const std::vector<T>& y, bool na_rm) {
+  Fused_sum sum;
+  if (x.empty() || y.empty()) {
+    return sum.value();
+  }
+  size_t final_size = std::max(x.size(), y.size());
+  for (size_t i = 0; i < final_size; ++i) {
+    const T& a = x[i % x.size()];
+    const T& b = y[i % y.size()];
+    if (!a || !b) {
+      if (na_rm) {
+        continue;
+      }
+      return Exact_number::NA_value();
+    }
+    add_products(sum, a, b);
+  }
+  return sum.value();
+}
+
+inline exact_numeric_p new_exact_scalar(const Exact_number& x) {
+  std::vector<Exact_number> result;
+  result.push_back(x);
+  exact_numeric* new_ex(new exact_numeric(result));
+  return {new_ex};
+}
+
+[[cpp11::register]]
+exact_numeric_p exact_numeric_sum_of_products(exact_numeric_p x, exact_numeric_p y, bool na_rm) {
+  Profile_scope profile(__func__, x);
+  if (x.get() == nullptr || y.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  return new_exact_scalar(sum_of_products_impl(x->get_storage(), y->get_storage(), na_rm));
+}
+
+[[cpp11::register]]
+exact_numeric_p vector_2_sum_of_products(vector2_p x, vector2_p y, bool na_rm) {
+  Profile_scope profile(__func__, x);
+  if (x.get() == nullptr || y.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  return new_exact_scalar(sum_of_products_impl(x->get_storage(), y->get_storage(), na_rm));
+}
+
+[[cpp11::register]]
+exact_numeric_p vector_3_sum_of_products(vector3_p x, vector3_p y, bool na_rm) {
+  Profile_scope profile(__func__, x);
+  if (x.get() == nullptr || y.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  return new_exact_scalar(sum_of_products_impl(x->get_storage(), y->get_storage(), na_rm));
+}
+
+[[cpp11::register]]
+exact_numeric_p vector_2_determinant(vector2_p u, vector2_p v) {
+  Profile_scope profile(__func__, u);
+  if (u.get() == nullptr || v.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  const std::vector<Vector_2>& u_s = u->get_storage();
+  const std::vector<Vector_2>& v_s = v->get_storage();
+  std::vector<Exact_number> result;
+  if (!u_s.empty() && !v_s.empty()) {
+    size_t final_size = std::max(u_s.size(), v_s.size());
+    result.reserve(final_size);
+    for (size_t i = 0; i < final_size; ++i) {
+      const Vector_2& a = u_s[i % u_s.size()];
+      const Vector_2& b = v_s[i % v_s.size()];
+      if (!a || !b) {
+        result.push_back(Exact_number::NA_value());
+        continue;
+      }
+      result.push_back(fused_determinant(a, b));
+    }
+  }
+  exact_numeric* new_ex(new exact_numeric(result));
+  return {new_ex};
+}
+
+[[cpp11::register]]
+exact_numeric_p vector_3_determinant(vector3_p u, vector3_p v, vector3_p w) {
+  Profile_scope profile(__func__, u);
+  if (u.get() == nullptr || v.get() == nullptr || w.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  const std::vector<Vector_3>& u_s = u->get_storage();
+  const std::vector<Vector_3>& v_s = v->get_storage();
+  const std::vector<Vector_3>& w_s = w->get_storage();
+  std::vector<Exact_number> result;
+  if (!u_s.empty() && !v_s.empty() && !w_s.empty()) {
+    size_t final_size = std::max(u_s.size(), std::max(v_s.size(), w_s.size()));
+    result.reserve(final_size);
+    for (size_t i = 0; i < final_size; ++i) {
+      const Vector_3& a = u_s[i % u_s.size()];
+      const Vector_3& b = v_s[i % v_s.size()];
+      const Vector_3& c = w_s[i % w_s.size()];
+      if (!a || !b || !c) {
+        result.push_back(Exact_number::NA_value());
+        continue;
+      }
+      result.push_back(fused_determinant(a, b, c));
+    }
+  }
+  exact_numeric* new_ex(new exact_numeric(result));
+  return {new_ex};
+}
+
+// Determinants of 2x2 or 3x3 matrices given by a vector for each entry, in
+// row-major order
+[[cpp11::register]]
+exact_numeric_p exact_numeric_determinant(cpp11::list_of<exact_numeric_p> entries) {
+  Profile_scope profile(__func__);
+  R_xlen_t n_entries = entries.size();
+  if (n_entries != 4 && n_entries != 9) {
+    cpp11::stop("Determinants require 4 or 9 entries");
+  }
+  std::vector<const std::vector<Exact_number>*> storage;
+  size_t final_size = 0;
+  bool any_empty = false;
+  for (R_xlen_t k = 0; k < n_entries; ++k) {
+    exact_numeric_p entry = entries[k];
+    if (entry.get() == nullptr) {
+      cpp11::stop("Data structure pointer cleared from memory");
+    }
+    storage.push_back(&entry->get_storage());
+    final_size = std::max(final_size, entry->size());
+    any_empty = any_empty || entry->size() == 0;
+  }
+
+  std::vector<Exact_number> result;
+  if (!any_empty) {
+    result.reserve(final_size);
+    std::vector<Exact_number> m(n_entries);
+    for (size_t i = 0; i < final_size; ++i) {
+      bool is_na = false;
+      for (R_xlen_t k = 0; k < n_entries && !is_na; ++k) {
+        m[k] = (*storage[k])[i % storage[k]->size()];
+        is_na = !m[k];
+      }
+      if (is_na) {
+        result.push_back(Exact_number::NA_value());
+        continue;
+      }
+      if (n_entries == 4) {
+        result.push_back(fused_determinant(m[0], m[1], m[2], m[3]));
+      } else {
+        result.push_back(fused_determinant(m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8]));
+      }
+    }
+  }
+  exact_numeric* new_ex(new exact_numeric(result));
+  return {new_ex};
+}
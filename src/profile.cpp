@@ -0,0 +1,42 @@
+#include "profile.h"
+
+#include <cpp11/list.hpp>
+#include <cpp11/strings.hpp>
+#include <cpp11/doubles.hpp>
+
+[[cpp11::register]]
+bool profile_enable(bool enable) {
+  bool was_enabled = profile_enabled();
+  profile_enabled() = enable;
+  return was_enabled;
+}
+
+[[cpp11::register]]
+void profile_reset() {
+  profile_registry().clear();
+}
+
+[[cpp11::register]]
+cpp11::writable::list profile_get() {
+  const Profile_registry& registry = profile_registry();
+  cpp11::writable::strings function;
+  cpp11::writable::strings type;
+  cpp11::writable::doubles calls;
+  cpp11::writable::doubles elements;
+  cpp11::writable::doubles seconds;
+  function.reserve(registry.size());
+  type.reserve(registry.size());
+  calls.reserve(registry.size());
+  elements.reserve(registry.size());
+  seconds.reserve(registry.size());
+
+  for (auto iter = registry.begin(); iter != registry.end(); ++iter) {
+    function.push_back(iter->first.first);
+    type.push_back(iter->first.second);
+    calls.push_back(iter->second.calls);
+    elements.push_back(iter->second.elements);
+    seconds.push_back(iter->second.seconds);
+  }
+
+  return {function, type, calls, elements, seconds};
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <utility>
+#include <chrono>
+#include <cpp11/external_pointer.hpp>
+
+// Opt-in profiling of the registered entry points. Each entry point creates a
+// Profile_scope as its first statement, which records the call, the number of
+// elements in the first argument, and the wall time spent when it goes out of
+// scope. When profiling is turned off the cost is a single flag check
+
+struct Profile_count {
+  double calls = 0;
+  double elements = 0;
+  double seconds = 0;
+};
+
+typedef std::map< std::pair<std::string, std::string>, Profile_count > Profile_registry;
+
+inline bool& profile_enabled() {
+  static bool enabled = false;
+  return enabled;
+}
+inline Profile_registry& profile_registry() {
+  static Profile_registry registry;
+  return registry;
+}
+
+class Profile_scope {
+  typedef std::chrono::steady_clock Clock;
+
+  Profile_count* _count;
+  size_t _elements;
+  Clock::time_point _start;
+
+  // The registry entry is created up front as inserting into the map may
+  // throw, which must not happen in the destructor during stack unwinding
+  void start(const char* name, const std::string& type) {
+    _count = &profile_registry()[std::make_pair(std::string(name), type)];
+    _start = Clock::now();
+  }
+
+public:
+  Profile_scope(const char* name) :
+    _count(nullptr),
+    _elements(0) {
+    if (profile_enabled()) {
+      start(name, "");
+    }
+  }
+  // Records the type (see vector_type_name()) and size of the first argument
+  template<typename V>
+  Profile_scope(const char* name, const cpp11::external_pointer<V>& x) :
+    _count(nullptr),
+    _elements(0) {
+    if (profile_enabled()) {
+      std::string type;
+      if (x.get() != nullptr) {
+        type = vector_type_name(*x);
+        _elements = x->size();
+      }
+      start(name, type);
+    }
+  }
+  ~Profile_scope() {
+    if (_count == nullptr) {
+      return;
+    }
+    std::chrono::duration<double> elapsed = Clock::now() - _start;
+    _count->calls += 1;
+    _count->elements += _elements;
+    _count->seconds += elapsed.count();
+  }
+};
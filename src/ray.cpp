@@ -8,6 +8,7 @@
 
 [[cpp11::register]]
 ray2_p create_ray_2_empty() {
+  Profile_scope profile(__func__);
   std::vector<Ray_2> vec;
   ray2 *result(new ray2(vec));
   return {result};
@@ -15,6 +16,7 @@ ray2_p create_ray_2_empty() {
 
 [[cpp11::register]]
 ray2_p create_ray_2_p_q(point2_p p, point2_p q) {
+  Profile_scope profile(__func__, p);
   std::vector<Ray_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -31,6 +33,7 @@ ray2_p create_ray_2_p_q(point2_p p, point2_p q) {
 
 [[cpp11::register]]
 ray2_p create_ray_2_p_d(point2_p p, direction2_p d) {
+  Profile_scope profile(__func__, p);
   std::vector<Ray_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -47,6 +50,7 @@ ray2_p create_ray_2_p_d(point2_p p, direction2_p d) {
 
 [[cpp11::register]]
 ray2_p create_ray_2_p_v(point2_p p, vector2_p v) {
+  Profile_scope profile(__func__, p);
   std::vector<Ray_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -63,6 +67,7 @@ ray2_p create_ray_2_p_v(point2_p p, vector2_p v) {
 
 [[cpp11::register]]
 ray2_p create_ray_2_p_l(point2_p p, line2_p l) {
+  Profile_scope profile(__func__, p);
   std::vector<Ray_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -79,6 +84,7 @@ ray2_p create_ray_2_p_l(point2_p p, line2_p l) {
 
 [[cpp11::register]]
 ray2_p ray_2_negate(ray2_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Ray_2> vec = -(*x);
   ray2 *result(new ray2(vec));
 
@@ -87,6 +93,7 @@ ray2_p ray_2_negate(ray2_p x) {
 
 [[cpp11::register]]
 ray3_p create_ray_3_empty() {
+  Profile_scope profile(__func__);
   std::vector<Ray_3> vec;
   ray3 *result(new ray3(vec));
   return {result};
@@ -94,6 +101,7 @@ ray3_p create_ray_3_empty() {
 
 [[cpp11::register]]
 ray3_p create_ray_3_p_q(point3_p p, point3_p q) {
+  Profile_scope profile(__func__, p);
   std::vector<Ray_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -110,6 +118,7 @@ ray3_p create_ray_3_p_q(point3_p p, point3_p q) {
 
 [[cpp11::register]]
 ray3_p create_ray_3_p_d(point3_p p, direction3_p d) {
+  Profile_scope profile(__func__, p);
   std::vector<Ray_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -126,6 +135,7 @@ ray3_p create_ray_3_p_d(point3_p p, direction3_p d) {
 
 [[cpp11::register]]
 ray3_p create_ray_3_p_v(point3_p p, vector3_p v) {
+  Profile_scope profile(__func__, p);
   std::vector<Ray_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -142,6 +152,7 @@ ray3_p create_ray_3_p_v(point3_p p, vector3_p v) {
 
 [[cpp11::register]]
 ray3_p create_ray_3_p_l(point3_p p, line3_p l) {
+  Profile_scope profile(__func__, p);
   std::vector<Ray_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -158,6 +169,7 @@ ray3_p create_ray_3_p_l(point3_p p, line3_p l) {
 
 [[cpp11::register]]
 ray3_p ray_3_negate(ray3_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Ray_3> vec = -(*x);
   ray3 *result(new ray3(vec));
 
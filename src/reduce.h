@@ -0,0 +1,99 @@
+#pragma once
+
+#include <vector>
+#include "materialize.h"
+
+// Reduces a vector by combining neighbouring elements pairwise, level by
+// level. Compared to a left fold this keeps the depth of the resulting lazy
+// construction DAG at O(log n) and combines exact operands of similar size.
+// The operation must be associative but need not be commutative, as the order
+// of the elements is preserved. Levels are evaluated serially (see the note
+// on threading in cgal_types.h)
+template<typename T, typename Op>
+inline T tree_reduce(std::vector<T> values, const T& init, Op op) {
+  if (values.empty()) {
+    return init;
+  }
+  while (values.size() > 1) {
+    size_t n = 0;
+    for (size_t i = 0; i + 1 < values.size(); i += 2) {
+      values[n++] = op(values[i], values[i + 1]);
+    }
+    if (values.size() % 2 == 1) {
+      values[n++] = values.back();
+    }
+    values.erase(values.begin() + n, values.end());
+  }
+  return values[0];
+}
+
+// Collects the non-NA elements of a vector for reduction. Returns false if an
+// NA is encountered and NAs should not be removed
+template<typename T>
+inline bool reduction_values(const std::vector<T>& storage, bool na_rm, std::vector<T>& values) {
+  values.reserve(storage.size());
+  for (size_t i = 0; i < storage.size(); ++i) {
+    if (!storage[i]) {
+      if (!na_rm) {
+        return false;
+      }
+      continue;
+    }
+    values.push_back(storage[i]);
+  }
+  return true;
+}
+
+// Inclusive prefix scan built from pairwise partial reductions (the up and
+// down sweep of a Blelloch scan, evaluated serially). Each output is combined
+// from O(log n) partial reductions that are shared between outputs, so the
+// lazy DAG of every output has depth O(log n) while the total number of
+// operations stays O(n). As with tree_reduce() the order of elements is
+// preserved. `on_level` is called with the partial reductions and the results
+// of every level along with the number of input elements each of them spans,
+// so that their history can be released before the next level builds on them
+template<typename T, typename Op, typename Level>
+inline std::vector<T> tree_scan(const std::vector<T>& values, Op op, Level on_level, size_t span = 1) {
+  size_t n = values.size();
+  if (n <= 1) {
+    return values;
+  }
+  std::vector<T> pairs;
+  pairs.reserve(n / 2);
+  for (size_t i = 0; i + 1 < n; i += 2) {
+    pairs.push_back(op(values[i], values[i + 1]));
+  }
+  on_level(pairs, 2 * span);
+  // pair_scan[k] holds the reduction of values[0] to values[2k + 1]
+  std::vector<T> pair_scan = tree_scan(pairs, op, on_level, 2 * span);
+
+  std::vector<T> result;
+  result.reserve(n);
+  result.push_back(values[0]);
+  for (size_t i = 1; i < n; ++i) {
+    if (i % 2 == 1) {
+      result.push_back(pair_scan[i / 2]);
+    } else {
+      result.push_back(op(pair_scan[i / 2 - 1], values[i]));
+    }
+  }
+  on_level(result, span);
+  return result;
+}
+
+// Cumulative version of tree_scan() where all elements from the first NA and
+// onwards are NA
+template<typename T, typename Op>
+inline std::vector<T> cumulative_scan(const std::vector<T>& storage, Op op) {
+  size_t n_valid = 0;
+  while (n_valid < storage.size() && storage[n_valid]) {
+    ++n_valid;
+  }
+  std::vector<T> result = tree_scan(
+    std::vector<T>(storage.begin(), storage.begin() + n_valid),
+    op,
+    auto_materialize_level<T>
+  );
+  result.insert(result.end(), storage.size() - n_valid, T::NA_value());
+  return result;
+}
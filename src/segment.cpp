@@ -6,6 +6,7 @@
 
 [[cpp11::register]]
 segment2_p create_segment_2_empty() {
+  Profile_scope profile(__func__);
   std::vector<Segment_2> vec;
   segment2 *result(new segment2(vec));
   return {result};
@@ -13,6 +14,7 @@ segment2_p create_segment_2_empty() {
 
 [[cpp11::register]]
 segment2_p create_segment_2_p_q(point2_p p, point2_p q) {
+  Profile_scope profile(__func__, p);
   std::vector<Segment_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -29,6 +31,7 @@ segment2_p create_segment_2_p_q(point2_p p, point2_p q) {
 
 [[cpp11::register]]
 segment2_p create_segment_2_p_v(point2_p p, vector2_p v) {
+  Profile_scope profile(__func__, p);
   std::vector<Segment_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -45,6 +48,7 @@ segment2_p create_segment_2_p_v(point2_p p, vector2_p v) {
 
 [[cpp11::register]]
 segment2_p segment_2_negate(segment2_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Segment_2> vec = -(*x);
   segment2 *result(new segment2(vec));
 
@@ -53,6 +57,7 @@ segment2_p segment_2_negate(segment2_p x) {
 
 [[cpp11::register]]
 segment3_p create_segment_3_empty() {
+  Profile_scope profile(__func__);
   std::vector<Segment_3> vec;
   segment3 *result(new segment3(vec));
   return {result};
@@ -60,6 +65,7 @@ segment3_p create_segment_3_empty() {
 
 [[cpp11::register]]
 segment3_p create_segment_3_p_q(point3_p p, point3_p q) {
+  Profile_scope profile(__func__, p);
   std::vector<Segment_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -76,6 +82,7 @@ segment3_p create_segment_3_p_q(point3_p p, point3_p q) {
 
 [[cpp11::register]]
 segment3_p create_segment_3_p_v(point3_p p, vector3_p v) {
+  Profile_scope profile(__func__, p);
   std::vector<Segment_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -92,6 +99,7 @@ segment3_p create_segment_3_p_v(point3_p p, vector3_p v) {
 
 [[cpp11::register]]
 segment3_p segment_3_negate(segment3_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Segment_3> vec = -(*x);
   segment3 *result(new segment3(vec));
 
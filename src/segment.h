@@ -15,6 +15,15 @@ public:
 
   Primitive geometry_type() const { return SEGMENT; }
 
+  cpp11::writable::logicals has_on(const geometry_vector_base& points) const {
+    bool handled;
+    cpp11::writable::logicals result = mirror_predicate<Segment_2, Point_2>(*this, points, Mirror_segment_has_on(), handled);
+    if (handled) {
+      return result;
+    }
+    return geometry_vector::has_on(points);
+  }
+
   size_t cardinality(size_t i) const { return 2; }
   size_t long_length() const { return size() * 2; }
 
@@ -59,9 +68,23 @@ public:
     switch (other.geometry_type()) {
     case ISORECT: return do_intersect_impl(get_vector_of_geo<Iso_rectangle>(other), _storage);
     case LINE: return do_intersect_impl(get_vector_of_geo<Line_2>(other), _storage);
-    case POINT: return do_intersect_impl(get_vector_of_geo<Point_2>(other), _storage);
+    case POINT: {
+      bool handled;
+      cpp11::writable::logicals result = mirror_predicate<Segment_2, Point_2>(*this, other, Mirror_segment_has_on(), handled);
+      if (handled) {
+        return result;
+      }
+      return do_intersect_impl(get_vector_of_geo<Point_2>(other), _storage);
+    }
     case RAY: return do_intersect_impl(get_vector_of_geo<Ray_2>(other), _storage);
-    case SEGMENT: return do_intersect_impl(_storage, get_vector_of_geo<Segment_2>(other));
+    case SEGMENT: {
+      bool handled;
+      cpp11::writable::logicals result = mirror_predicate<Segment_2, Segment_2>(*this, other, Mirror_segments_intersect(), handled);
+      if (handled) {
+        return result;
+      }
+      return do_intersect_impl(_storage, get_vector_of_geo<Segment_2>(other));
+    }
     case TRIANGLE: return do_intersect_impl(_storage, get_vector_of_geo<Triangle_2>(other));
     default: return unknown_intersect_impl(std::max(size(), other.size()));
     }
@@ -0,0 +1,128 @@
+#include "cgal_types.h"
+#include "geometry_vector.h"
+
+#include <cpp11/matrix.hpp>
+#include <cpp11/external_pointer.hpp>
+
+#include <vector>
+#include <algorithm>
+
+#include <CGAL/intersections.h>
+#include <CGAL/box_intersection_d.h>
+
+typedef CGAL::Box_intersection_d::Box_with_handle_d<double, 3, const Kernel::Triangle_3*> Triangle_box;
+
+// Tests whether the ray from v through p lies strictly inside the angle at v
+// spanned by the rays towards q1 and q2. All points must be coplanar
+inline bool inside_angle(const Kernel::Point_3& v, const Kernel::Point_3& q1, const Kernel::Point_3& q2, const Kernel::Point_3& p) {
+  return CGAL::coplanar_orientation(v, q1, q2, p) == CGAL::POSITIVE &&
+    CGAL::coplanar_orientation(v, q2, q1, p) == CGAL::POSITIVE;
+}
+
+inline bool same_ray(const Kernel::Point_3& v, const Kernel::Point_3& p, const Kernel::Point_3& q) {
+  return CGAL::collinear(v, p, q) && (p - v) * (q - v) > 0;
+}
+
+// Test whether two non-degenerate triangles intersect in more than what is
+// implied by their shared vertices (i.e. touching in a shared vertex or along
+// a shared edge is not considered an intersection)
+inline bool triangles_self_intersect(const Kernel::Triangle_3& a, const Kernel::Triangle_3& b) {
+  int shared_a[3] = {-1, -1, -1};
+  int n_shared = 0;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      if (a.vertex(i) == b.vertex(j)) {
+        shared_a[i] = j;
+        ++n_shared;
+        break;
+      }
+    }
+  }
+
+  switch (n_shared) {
+  case 0: return CGAL::do_intersect(a, b);
+  case 1: {
+    int i = shared_a[0] != -1 ? 0 : (shared_a[1] != -1 ? 1 : 2);
+    int j = shared_a[i];
+    const Kernel::Point_3& v = a.vertex(i);
+    const Kernel::Point_3& a1 = a.vertex((i + 1) % 3);
+    const Kernel::Point_3& a2 = a.vertex((i + 2) % 3);
+    const Kernel::Point_3& b1 = b.vertex((j + 1) % 3);
+    const Kernel::Point_3& b2 = b.vertex((j + 2) % 3);
+    // Any intersection away from the shared vertex must cross the opposite edge
+    // of one of the triangles, unless they are coplanar and one lies in the
+    // angle of the other at the shared vertex
+    if (CGAL::do_intersect(Kernel::Segment_3(a1, a2), b) || CGAL::do_intersect(Kernel::Segment_3(b1, b2), a)) {
+      return true;
+    }
+    if (!CGAL::coplanar(v, a1, a2, b1) || !CGAL::coplanar(v, a1, a2, b2)) {
+      return false;
+    }
+    return inside_angle(v, b1, b2, a1) || inside_angle(v, b1, b2, a2) ||
+      inside_angle(v, a1, a2, b1) || inside_angle(v, a1, a2, b2) ||
+      (same_ray(v, a1, b1) && same_ray(v, a2, b2)) ||
+      (same_ray(v, a1, b2) && same_ray(v, a2, b1));
+  }
+  case 2: {
+    // Triangles sharing an edge only intersect if they fold onto each other
+    int i = shared_a[0] == -1 ? 0 : (shared_a[1] == -1 ? 1 : 2);
+    const Kernel::Point_3& a_opposite = a.vertex(i);
+    const Kernel::Point_3& s1 = a.vertex((i + 1) % 3);
+    const Kernel::Point_3& s2 = a.vertex((i + 2) % 3);
+    int j = 3 - shared_a[(i + 1) % 3] - shared_a[(i + 2) % 3];
+    const Kernel::Point_3& b_opposite = b.vertex(j);
+    return CGAL::coplanar(s1, s2, a_opposite, b_opposite) &&
+      CGAL::coplanar_orientation(s1, s2, a_opposite, b_opposite) == CGAL::POSITIVE;
+  }
+  }
+  // Duplicated triangles
+  return true;
+}
+
+struct Self_intersection_callback {
+  const Kernel::Triangle_3* base;
+  std::vector< std::pair<int, int> >* pairs;
+
+  void operator()(const Triangle_box& a, const Triangle_box& b) const {
+    if (triangles_self_intersect(*a.handle(), *b.handle())) {
+      int i = a.handle() - base;
+      int j = b.handle() - base;
+      pairs->push_back(std::make_pair(std::min(i, j), std::max(i, j)));
+    }
+  }
+};
+
+[[cpp11::register]]
+cpp11::writable::integers_matrix geometry_self_intersections(geometry_vector_base_p triangles) {
+  Profile_scope profile(__func__, triangles);
+  if (triangles.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  if (triangles->geometry_type() != TRIANGLE || triangles->dimensions() != 3) {
+    cpp11::stop("Self intersections can only be found for 3 dimensional triangles");
+  }
+  std::vector<Triangle_3> vec = get_vector_of_geo<Triangle_3>(*triangles);
+  std::vector<Kernel::Triangle_3> tri(vec.begin(), vec.end());
+
+  std::vector<Triangle_box> boxes;
+  boxes.reserve(tri.size());
+  for (size_t i = 0; i < tri.size(); ++i) {
+    if (!vec[i] || vec[i].is_degenerate()) {
+      continue;
+    }
+    boxes.push_back(Triangle_box(tri[i].bbox(), &tri[i]));
+  }
+
+  std::vector< std::pair<int, int> > pairs;
+  Self_intersection_callback callback = {tri.data(), &pairs};
+  // Serial on purpose, see the note on threading in cgal_types.h
+  CGAL::box_self_intersection_d(boxes.begin(), boxes.end(), callback);
+  std::sort(pairs.begin(), pairs.end());
+
+  cpp11::writable::integers_matrix result(pairs.size(), 2);
+  for (size_t i = 0; i < pairs.size(); ++i) {
+    result(i, 0) = pairs[i].first + 1;
+    result(i, 1) = pairs[i].second + 1;
+  }
+  return result;
+}
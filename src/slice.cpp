@@ -0,0 +1,125 @@
+#include "cgal_types.h"
+#include "geometry_vector.h"
+
+#include <cpp11/list.hpp>
+#include <cpp11/integers.hpp>
+#include <cpp11/external_pointer.hpp>
+
+#include <vector>
+#include <algorithm>
+
+#include <CGAL/intersections.h>
+#include <boost/variant/get.hpp>
+
+// A set of parallel planes, stored with their level along a shared normal so
+// that the planes hitting a triangle can be found by binary search
+struct Plane_stack {
+  Kernel::Vector_3 normal;
+  std::vector< std::pair<Kernel::FT, int> > levels;
+};
+
+inline std::vector<Plane_stack> stack_planes(const std::vector<Plane>& planes) {
+  std::vector<Plane_stack> stacks;
+  for (size_t i = 0; i < planes.size(); ++i) {
+    if (!planes[i] || planes[i].is_degenerate()) {
+      continue;
+    }
+    Kernel::Vector_3 normal = planes[i].orthogonal_vector();
+    // Planes are most often given as a single stack so the last stack is a
+    // good first guess
+    int stack = -1;
+    for (int j = stacks.size() - 1; j >= 0; --j) {
+      if (CGAL::cross_product(stacks[j].normal, normal) == CGAL::NULL_VECTOR) {
+        stack = j;
+        break;
+      }
+    }
+    if (stack == -1) {
+      stacks.push_back({normal, {}});
+      stack = stacks.size() - 1;
+    }
+    // With the plane normal being k times the stack normal, the plane is given
+    // by the points where normal * p == -d / k
+    const Kernel::Vector_3& stack_normal = stacks[stack].normal;
+    Kernel::FT k = (normal * stack_normal) / stack_normal.squared_length();
+    stacks[stack].levels.emplace_back(-planes[i].d() / k, i);
+  }
+  for (auto iter = stacks.begin(); iter != stacks.end(); ++iter) {
+    std::sort(iter->levels.begin(), iter->levels.end());
+  }
+  return stacks;
+}
+
+struct Slice_hit {
+  int plane;
+  int triangle;
+  Kernel::Segment_3 segment;
+};
+
+inline bool operator<(const Slice_hit& a, const Slice_hit& b) {
+  return a.plane < b.plane || (a.plane == b.plane && a.triangle < b.triangle);
+}
+
+[[cpp11::register]]
+cpp11::writable::list geometry_slice_triangles(geometry_vector_base_p triangles, geometry_vector_base_p planes) {
+  Profile_scope profile(__func__, triangles);
+  if (triangles.get() == nullptr || planes.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  if (triangles->geometry_type() != TRIANGLE || triangles->dimensions() != 3) {
+    cpp11::stop("Slicing is only defined for 3 dimensional triangles");
+  }
+  if (planes->geometry_type() != PLANE) {
+    cpp11::stop("Triangles can only be sliced by planes");
+  }
+  std::vector<Triangle_3> tri = get_vector_of_geo<Triangle_3>(*triangles);
+  std::vector<Plane> pl = get_vector_of_geo<Plane>(*planes);
+  std::vector<Plane_stack> stacks = stack_planes(pl);
+
+  std::vector<Slice_hit> hits;
+  for (auto stack = stacks.begin(); stack != stacks.end(); ++stack) {
+    for (size_t i = 0; i < tri.size(); ++i) {
+      if (!tri[i] || tri[i].is_degenerate()) {
+        continue;
+      }
+      Kernel::FT l0 = stack->normal * (tri[i].vertex(0) - CGAL::ORIGIN);
+      Kernel::FT l1 = stack->normal * (tri[i].vertex(1) - CGAL::ORIGIN);
+      Kernel::FT l2 = stack->normal * (tri[i].vertex(2) - CGAL::ORIGIN);
+      Kernel::FT lo = CGAL::min(l0, CGAL::min(l1, l2));
+      Kernel::FT hi = CGAL::max(l0, CGAL::max(l1, l2));
+      // Triangles parallel to the stack are either not hit or lies in the plane
+      if (lo == hi) {
+        continue;
+      }
+      auto first = std::lower_bound(stack->levels.begin(), stack->levels.end(), std::make_pair(lo, -1));
+      for (auto level = first; level != stack->levels.end() && level->first <= hi; ++level) {
+        auto cut = CGAL::intersection(pl[level->second], tri[i]);
+        if (!cut) {
+          continue;
+        }
+        if (const Kernel::Segment_3* s = boost::get<Kernel::Segment_3>(&*cut)) {
+          hits.push_back({level->second, static_cast<int>(i), *s});
+        }
+      }
+    }
+  }
+  std::sort(hits.begin(), hits.end());
+
+  std::vector<Segment_3> segments;
+  cpp11::writable::integers plane_index;
+  cpp11::writable::integers triangle_index;
+  segments.reserve(hits.size());
+  plane_index.reserve(hits.size());
+  triangle_index.reserve(hits.size());
+  for (auto iter = hits.begin(); iter != hits.end(); ++iter) {
+    segments.push_back(iter->segment);
+    plane_index.push_back(iter->plane + 1);
+    triangle_index.push_back(iter->triangle + 1);
+  }
+
+  cpp11::writable::list result;
+  result.push_back(create_geometry_vector(segments));
+  result.push_back(plane_index);
+  result.push_back(triangle_index);
+  return result;
+}
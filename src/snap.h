@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cmath>
+#include "cgal_types.h"
+#include "approximate.h"
+
+// Opt-in snap rounding of the results of constructions. Rounded results are
+// stored as doubles so their size does not grow along chains of constructions
+
+// Spacing of the grid point coordinates are snapped to. 0 snaps to the nearest
+// double, while a negative spacing turns snapping off. Other spacings must be
+// powers of two (validated in R) so the scaling below is exact
+inline double& snap_grid() {
+  static double grid = -1.0;
+  return grid;
+}
+
+struct Round_to_grid {
+  double grid;
+
+  Kernel::FT coord(const Kernel::FT& x) const {
+    double val = nearest_double(x);
+    if (grid == 0) {
+      return val;
+    }
+    double scaled = val / grid;
+    double k = std::nearbyint(scaled);
+    // Rounding to a double may have moved x onto the midpoint between two
+    // grid points, in which case the exact value decides the side
+    if (scaled - std::floor(scaled) == 0.5 && x != Kernel::FT(val)) {
+      k = x < Kernel::FT(val) ? std::floor(scaled) : std::ceil(scaled);
+    }
+    double snapped = k * grid;
+    return std::isfinite(snapped) ? snapped : val;
+  }
+  Kernel::FT value(const Kernel::FT& x) const {
+    return nearest_double(x);
+  }
+};
+
+template<typename T>
+inline T snap_construction(const T& geometry) {
+  double grid = snap_grid();
+  if (grid < 0 || !geometry) {
+    return geometry;
+  }
+  return round_impl(geometry, Round_to_grid{grid});
+}
@@ -0,0 +1,71 @@
+#include "cgal_types.h"
+#include "geometry_vector.h"
+#include "snap.h"
+
+#include <cpp11/list.hpp>
+#include <cpp11/integers.hpp>
+#include <cpp11/external_pointer.hpp>
+
+#include <vector>
+#include <list>
+#include <iterator>
+
+#include <CGAL/Snap_rounding_traits_2.h>
+#include <CGAL/Snap_rounding_2.h>
+
+typedef CGAL::Snap_rounding_traits_2<Kernel> Snap_traits;
+typedef std::list<Kernel::Point_2> Polyline_2;
+
+[[cpp11::register]]
+double set_snap_grid(double grid) {
+  Profile_scope profile(__func__);
+  double old_grid = snap_grid();
+  snap_grid() = grid;
+  return old_grid;
+}
+
+[[cpp11::register]]
+cpp11::writable::list geometry_snap_round(geometry_vector_base_p segments, double pixel_size, bool iterated) {
+  Profile_scope profile(__func__, segments);
+  if (segments.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  if (segments->geometry_type() != SEGMENT || segments->dimensions() != 2) {
+    cpp11::stop("Snap rounding can only be done on 2 dimensional segments");
+  }
+  std::vector<Segment_2> vec = get_vector_of_geo<Segment_2>(*segments);
+  std::vector<Kernel::Segment_2> input;
+  std::vector<int> input_index;
+  input.reserve(vec.size());
+  input_index.reserve(vec.size());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    if (!vec[i] || vec[i].is_degenerate()) {
+      continue;
+    }
+    input.push_back(vec[i]);
+    input_index.push_back(i);
+  }
+
+  // Polylines are returned in the order of the input segments
+  std::list<Polyline_2> polylines;
+  CGAL::snap_rounding_2<Snap_traits>(input.begin(), input.end(), polylines, pixel_size, iterated, false, 1);
+
+  std::vector<Segment_2> result;
+  cpp11::writable::integers segment_index;
+  size_t k = 0;
+  for (auto polyline = polylines.begin(); polyline != polylines.end(); ++polyline, ++k) {
+    if (polyline->size() < 2) {
+      continue;
+    }
+    auto source = polyline->begin();
+    for (auto target = std::next(source); target != polyline->end(); ++source, ++target) {
+      result.push_back(Kernel::Segment_2(*source, *target));
+      segment_index.push_back(input_index[k] + 1);
+    }
+  }
+
+  cpp11::writable::list output;
+  output.push_back(create_geometry_vector(result));
+  output.push_back(segment_index);
+  return output;
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "cgal_types.h"
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+
+typedef CGAL::Simple_cartesian<double> Approx_kernel;
+
+inline Approx_kernel::Point_2 bbox_center(const CGAL::Bbox_2& box) {
+  return Approx_kernel::Point_2(
+    (box.xmin() + box.xmax()) / 2.0,
+    (box.ymin() + box.ymax()) / 2.0
+  );
+}
+inline Approx_kernel::Point_3 bbox_center(const CGAL::Bbox_3& box) {
+  return Approx_kernel::Point_3(
+    (box.xmin() + box.xmax()) / 2.0,
+    (box.ymin() + box.ymax()) / 2.0,
+    (box.zmin() + box.zmax()) / 2.0
+  );
+}
+
+// Spreads the lower bits of a cell index so that they can be interleaved with
+// the bits of the other coordinates
+inline uint64_t morton_spread(uint64_t x, size_t dim) {
+  if (dim == 2) {
+    x &= 0x00000000FFFFFFFF;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFF;
+    x = (x | (x << 8))  & 0x00FF00FF00FF00FF;
+    x = (x | (x << 4))  & 0x0F0F0F0F0F0F0F0F;
+    x = (x | (x << 2))  & 0x3333333333333333;
+    x = (x | (x << 1))  & 0x5555555555555555;
+  } else {
+    x &= 0x00000000001FFFFF;
+    x = (x | (x << 32)) & 0x001F00000000FFFF;
+    x = (x | (x << 16)) & 0x001F0000FF0000FF;
+    x = (x | (x << 8))  & 0x100F00F00F00F00F;
+    x = (x | (x << 4))  & 0x10C30C30C30C30C3;
+    x = (x | (x << 2))  & 0x1249249249249249;
+  }
+  return x;
+}
+
+inline uint64_t morton_cell(double val, double min, double range, size_t dim) {
+  double max_cell = dim == 2 ? 4294967295.0 : 2097151.0;
+  if (range <= 0) {
+    return 0;
+  }
+  double cell = std::floor((val - min) / range * max_cell);
+  return static_cast<uint64_t>(std::max(0.0, std::min(cell, max_cell)));
+}
+
+template<typename Point>
+inline std::vector<uint64_t> morton_codes(const std::vector<Point>& points, size_t dim) {
+  std::vector<double> min(dim, std::numeric_limits<double>::infinity());
+  std::vector<double> max(dim, -std::numeric_limits<double>::infinity());
+  for (auto iter = points.begin(); iter != points.end(); ++iter) {
+    for (size_t j = 0; j < dim; ++j) {
+      min[j] = std::min(min[j], (*iter)[j]);
+      max[j] = std::max(max[j], (*iter)[j]);
+    }
+  }
+  std::vector<uint64_t> codes;
+  codes.reserve(points.size());
+  for (auto iter = points.begin(); iter != points.end(); ++iter) {
+    uint64_t code = 0;
+    for (size_t j = 0; j < dim; ++j) {
+      code |= morton_spread(morton_cell((*iter)[j], min[j], max[j] - min[j], dim), dim) << j;
+    }
+    codes.push_back(code);
+  }
+  return codes;
+}
+
+template<typename Point>
+inline void morton_order(std::vector<int>& order, const std::vector<Point>& points, size_t dim) {
+  std::vector<uint64_t> codes = morton_codes(points, dim);
+  std::stable_sort(order.begin(), order.end(), [&codes](int a, int b) {
+    return codes[a] < codes[b];
+  });
+}
+
+inline void hilbert_order(std::vector<int>& order, std::vector<Approx_kernel::Point_2>& points) {
+  typedef CGAL::Spatial_sort_traits_adapter_2<Approx_kernel, CGAL::Pointer_property_map<Approx_kernel::Point_2>::type> Traits;
+  CGAL::hilbert_sort(order.begin(), order.end(), Traits(CGAL::make_property_map(points)));
+}
+inline void hilbert_order(std::vector<int>& order, std::vector<Approx_kernel::Point_3>& points) {
+  typedef CGAL::Spatial_sort_traits_adapter_3<Approx_kernel, CGAL::Pointer_property_map<Approx_kernel::Point_3>::type> Traits;
+  CGAL::hilbert_sort(order.begin(), order.end(), Traits(CGAL::make_property_map(points)));
+}
+
+// Calculates the order of the elements along a space filling curve based on
+// the center of their bounding box. Elements without a finite bounding box are
+// placed at the end in their original order. The returned indices are 0-based
+template<typename Bbox>
+inline std::vector<int> spatial_order_impl(const std::vector<Bbox>& boxes, bool hilbert) {
+  typedef decltype(bbox_center(boxes[0].base())) Point;
+  size_t dim = Point::Ambient_dimension::value;
+
+  std::vector<Point> centers;
+  std::vector<int> valid;
+  std::vector<int> invalid;
+  centers.reserve(boxes.size());
+  valid.reserve(boxes.size());
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    if (!boxes[i]) {
+      invalid.push_back(i);
+      continue;
+    }
+    Point center = bbox_center(boxes[i].base());
+    bool finite = true;
+    for (size_t j = 0; j < dim; ++j) {
+      finite = finite && std::isfinite(center[j]);
+    }
+    if (!finite) {
+      invalid.push_back(i);
+      continue;
+    }
+    valid.push_back(i);
+    centers.push_back(center);
+  }
+
+  std::vector<int> order(centers.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  if (hilbert) {
+    hilbert_order(order, centers);
+  } else {
+    morton_order(order, centers, dim);
+  }
+
+  std::vector<int> result;
+  result.reserve(boxes.size());
+  for (auto iter = order.begin(); iter != order.end(); ++iter) {
+    result.push_back(valid[*iter]);
+  }
+  result.insert(result.end(), invalid.begin(), invalid.end());
+  return result;
+}
@@ -4,6 +4,7 @@
 
 [[cpp11::register]]
 sphere_p create_sphere_empty() {
+  Profile_scope profile(__func__);
   std::vector<Sphere> vec;
   sphere *result(new sphere(vec));
   return {result};
@@ -11,6 +12,7 @@ sphere_p create_sphere_empty() {
 
 [[cpp11::register]]
 sphere_p create_sphere_center_radius(point3_p center, exact_numeric_p r2) {
+  Profile_scope profile(__func__, center);
   std::vector<Sphere> vec;
   vec.reserve(center->size());
   for (size_t i = 0; i < center->size(); ++i) {
@@ -27,6 +29,7 @@ sphere_p create_sphere_center_radius(point3_p center, exact_numeric_p r2) {
 
 [[cpp11::register]]
 sphere_p create_sphere_4_point(point3_p p, point3_p q, point3_p r, point3_p s) {
+  Profile_scope profile(__func__, p);
   std::vector<Sphere> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -48,6 +51,7 @@ sphere_p create_sphere_4_point(point3_p p, point3_p q, point3_p r, point3_p s) {
 
 [[cpp11::register]]
 sphere_p create_sphere_3_point(point3_p p, point3_p q, point3_p r) {
+  Profile_scope profile(__func__, p);
   std::vector<Sphere> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -64,6 +68,7 @@ sphere_p create_sphere_3_point(point3_p p, point3_p q, point3_p r) {
 
 [[cpp11::register]]
 sphere_p create_sphere_2_point(point3_p p, point3_p q) {
+  Profile_scope profile(__func__, p);
   std::vector<Sphere> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -80,6 +85,7 @@ sphere_p create_sphere_2_point(point3_p p, point3_p q) {
 
 [[cpp11::register]]
 sphere_p create_sphere_circle(circle3_p circ) {
+  Profile_scope profile(__func__, circ);
   std::vector<Sphere> vec;
   vec.reserve(circ->size());
   for (size_t i = 0; i < circ->size(); ++i) {
@@ -3,6 +3,7 @@
 
 [[cpp11::register]]
 tetrahedron_p create_tetrahedron_empty() {
+  Profile_scope profile(__func__);
   std::vector<Tetrahedron> vec;
   tetrahedron *result(new tetrahedron(vec));
   return {result};
@@ -10,6 +11,7 @@ tetrahedron_p create_tetrahedron_empty() {
 
 [[cpp11::register]]
 tetrahedron_p create_tetrahedron_4points(point3_p p, point3_p q, point3_p r, point3_p s) {
+  Profile_scope profile(__func__, p);
   std::vector<Tetrahedron> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -41,6 +41,7 @@ const std::vector<Aff_transformation_3> get_vector_of_trans(const transform_vect
 
 [[cpp11::register]]
 transform2_p create_transform_2_identity(int n) {
+  Profile_scope profile(__func__);
   std::vector<Aff_transformation_2> vec;
   vec.reserve(n);
   for (int i = 0; i < n; ++i) {
@@ -54,6 +55,7 @@ transform2_p create_transform_2_identity(int n) {
 
 [[cpp11::register]]
 transform2_p create_transform_2_matrix(cpp11::list_of<cpp11::doubles_matrix> matrices) {
+  Profile_scope profile(__func__);
   std::vector<Aff_transformation_2> vec;
   vec.reserve(matrices.size());
   for (int i = 0; i < matrices.size(); ++i) {
@@ -73,6 +75,7 @@ transform2_p create_transform_2_matrix(cpp11::list_of<cpp11::doubles_matrix> mat
 
 [[cpp11::register]]
 transform2_p create_transform_2_translate(vector2_p trans) {
+  Profile_scope profile(__func__, trans);
   std::vector<Aff_transformation_2> vec;
   vec.reserve(trans->size());
   for (int i = 0; i < trans->size(); ++i) {
@@ -90,6 +93,7 @@ transform2_p create_transform_2_translate(vector2_p trans) {
 
 [[cpp11::register]]
 transform2_p create_transform_2_rotate(exact_numeric_p rho) {
+  Profile_scope profile(__func__, rho);
   std::vector<Aff_transformation_2> vec;
   vec.reserve(rho->size());
   for (int i = 0; i < rho->size(); ++i) {
@@ -108,6 +112,7 @@ transform2_p create_transform_2_rotate(exact_numeric_p rho) {
 
 [[cpp11::register]]
 transform2_p create_transform_2_scale(exact_numeric_p fac) {
+  Profile_scope profile(__func__, fac);
   std::vector<Aff_transformation_2> vec;
   vec.reserve(fac->size());
   for (int i = 0; i < fac->size(); ++i) {
@@ -125,6 +130,7 @@ transform2_p create_transform_2_scale(exact_numeric_p fac) {
 
 [[cpp11::register]]
 transform3_p create_transform_3_identity(int n) {
+  Profile_scope profile(__func__);
   std::vector<Aff_transformation_3> vec;
   vec.reserve(n);
   for (int i = 0; i < n; ++i) {
@@ -138,6 +144,7 @@ transform3_p create_transform_3_identity(int n) {
 
 [[cpp11::register]]
 transform3_p create_transform_3_matrix(cpp11::list_of<cpp11::doubles_matrix> matrices) {
+  Profile_scope profile(__func__);
   std::vector<Aff_transformation_3> vec;
   vec.reserve(matrices.size());
   for (int i = 0; i < matrices.size(); ++i) {
@@ -158,6 +165,7 @@ transform3_p create_transform_3_matrix(cpp11::list_of<cpp11::doubles_matrix> mat
 
 [[cpp11::register]]
 transform3_p create_transform_3_translate(vector3_p trans) {
+  Profile_scope profile(__func__, trans);
   std::vector<Aff_transformation_3> vec;
   vec.reserve(trans->size());
   for (int i = 0; i < trans->size(); ++i) {
@@ -175,6 +183,7 @@ transform3_p create_transform_3_translate(vector3_p trans) {
 
 [[cpp11::register]]
 transform3_p create_transform_3_scale(exact_numeric_p fac) {
+  Profile_scope profile(__func__, fac);
   std::vector<Aff_transformation_3> vec;
   vec.reserve(fac->size());
   for (int i = 0; i < fac->size(); ++i) {
@@ -193,6 +202,7 @@ transform3_p create_transform_3_scale(exact_numeric_p fac) {
 
 [[cpp11::register]]
 int transform_length(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     return 0;
   }
@@ -201,6 +211,7 @@ int transform_length(transform_vector_base_p transforms) {
 
 [[cpp11::register]]
 int transform_dimension(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     return 0;
   }
@@ -209,6 +220,7 @@ int transform_dimension(transform_vector_base_p transforms) {
 
 [[cpp11::register]]
 exact_numeric_p transform_definition(transform_vector_base_p transforms, cpp11::integers i, cpp11::integers j) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -218,6 +230,7 @@ exact_numeric_p transform_definition(transform_vector_base_p transforms, cpp11::
 
 [[cpp11::register]]
 transform_vector_base_p transform_subset(transform_vector_base_p transforms, cpp11::integers index) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -226,6 +239,7 @@ transform_vector_base_p transform_subset(transform_vector_base_p transforms, cpp
 
 [[cpp11::register]]
 transform_vector_base_p transform_copy(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -234,6 +248,7 @@ transform_vector_base_p transform_copy(transform_vector_base_p transforms) {
 
 [[cpp11::register]]
 transform_vector_base_p transform_assign(transform_vector_base_p transforms, cpp11::integers index, transform_vector_base_p value) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr || value.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -242,6 +257,7 @@ transform_vector_base_p transform_assign(transform_vector_base_p transforms, cpp
 
 [[cpp11::register]]
 transform_vector_base_p transform_combine(transform_vector_base_p transforms, cpp11::list_of< transform_vector_base_p > extra) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -250,6 +266,7 @@ transform_vector_base_p transform_combine(transform_vector_base_p transforms, cp
 
 [[cpp11::register]]
 transform_vector_base_p transform_unique(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -258,6 +275,7 @@ transform_vector_base_p transform_unique(transform_vector_base_p transforms) {
 
 [[cpp11::register]]
 cpp11::writable::logicals transform_duplicated(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -266,11 +284,13 @@ cpp11::writable::logicals transform_duplicated(transform_vector_base_p transform
 
 [[cpp11::register]]
 cpp11::writable::integers transform_any_duplicated(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
   return {transforms->any_duplicated() + 1};
 }
 
 [[cpp11::register]]
 cpp11::writable::integers transform_match(transform_vector_base_p transforms, transform_vector_base_p table) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr || table.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -279,6 +299,7 @@ cpp11::writable::integers transform_match(transform_vector_base_p transforms, tr
 
 [[cpp11::register]]
 cpp11::writable::logicals transform_is_na(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -287,6 +308,7 @@ cpp11::writable::logicals transform_is_na(transform_vector_base_p transforms) {
 
 [[cpp11::register]]
 bool transform_any_na(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -295,6 +317,7 @@ bool transform_any_na(transform_vector_base_p transforms) {
 
 [[cpp11::register]]
 cpp11::writable::doubles transform_to_array(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -303,6 +326,7 @@ cpp11::writable::doubles transform_to_array(transform_vector_base_p transforms)
 
 [[cpp11::register]]
 cpp11::writable::strings transform_format(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     return {">>>Data structure pointer cleared from memory<<<"};
   }
@@ -312,6 +336,7 @@ cpp11::writable::strings transform_format(transform_vector_base_p transforms) {
 [[cpp11::register]]
 cpp11::writable::logicals transform_is_equal(transform_vector_base_p transforms1,
                                             transform_vector_base_p transforms2) {
+  Profile_scope profile(__func__, transforms1);
   if (transforms1.get() == nullptr || transforms2.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -320,6 +345,7 @@ cpp11::writable::logicals transform_is_equal(transform_vector_base_p transforms1
 
 [[cpp11::register]]
 transform_vector_base_p transform_multiply(transform_vector_base_p transforms, transform_vector_base_p other) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr || other.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -328,6 +354,7 @@ transform_vector_base_p transform_multiply(transform_vector_base_p transforms, t
 
 [[cpp11::register]]
 transform_vector_base_p transform_inverse(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -336,6 +363,7 @@ transform_vector_base_p transform_inverse(transform_vector_base_p transforms) {
 
 [[cpp11::register]]
 cpp11::writable::logicals transform_is_reflecting(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -344,6 +372,7 @@ cpp11::writable::logicals transform_is_reflecting(transform_vector_base_p transf
 
 [[cpp11::register]]
 transform_vector_base_p transform_prod(transform_vector_base_p transforms, bool na_rm) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
@@ -352,8 +381,27 @@ transform_vector_base_p transform_prod(transform_vector_base_p transforms, bool
 
 [[cpp11::register]]
 transform_vector_base_p transform_cumprod(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
   if (transforms.get() == nullptr) {
     cpp11::stop("Data structure pointer cleared from memory");
   }
   return transforms->cumprod();
 }
+
+[[cpp11::register]]
+void transform_materialize(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
+  if (transforms.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  transforms->materialize();
+}
+
+[[cpp11::register]]
+cpp11::writable::doubles transform_memory_usage(transform_vector_base_p transforms) {
+  Profile_scope profile(__func__, transforms);
+  if (transforms.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  return transforms->memory_usage();
+}
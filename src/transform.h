@@ -11,6 +11,9 @@
 #include "cgal_types.h"
 #include "exact_numeric.h"
 #include "match.h"
+#include "materialize.h"
+#include "reduce.h"
+#include "expansion.h"
 
 #include <sstream>
 #include <iomanip>
@@ -43,6 +46,62 @@ inline Sphere transform_impl<Sphere, Aff_transformation_3>(const Sphere& geo, co
   }
   return geo.orthogonal_transform(trans);
 }
+// Points, segments, and triangles defined by doubles are first attempted
+// transformed with expansion arithmetic (see expansion.h)
+template<>
+inline Point_2 transform_impl<Point_2, Aff_transformation_2>(const Point_2& geo, const Aff_transformation_2& trans) {
+  Kernel::Point_2 result;
+  if (expansion_transform<Kernel::Point_2>(geo, trans, result)) {
+    return result;
+  }
+  return geo.transform(trans);
+}
+template<>
+inline Point_3 transform_impl<Point_3, Aff_transformation_3>(const Point_3& geo, const Aff_transformation_3& trans) {
+  Kernel::Point_3 result;
+  if (expansion_transform<Kernel::Point_3>(geo, trans, result)) {
+    return result;
+  }
+  return geo.transform(trans);
+}
+template<>
+inline Segment_2 transform_impl<Segment_2, Aff_transformation_2>(const Segment_2& geo, const Aff_transformation_2& trans) {
+  Kernel::Point_2 source, target;
+  if (expansion_transform<Kernel::Point_2>(geo.source(), trans, source) &&
+      expansion_transform<Kernel::Point_2>(geo.target(), trans, target)) {
+    return Kernel::Segment_2(source, target);
+  }
+  return geo.transform(trans);
+}
+template<>
+inline Segment_3 transform_impl<Segment_3, Aff_transformation_3>(const Segment_3& geo, const Aff_transformation_3& trans) {
+  Kernel::Point_3 source, target;
+  if (expansion_transform<Kernel::Point_3>(geo.source(), trans, source) &&
+      expansion_transform<Kernel::Point_3>(geo.target(), trans, target)) {
+    return Kernel::Segment_3(source, target);
+  }
+  return geo.transform(trans);
+}
+template<>
+inline Triangle_2 transform_impl<Triangle_2, Aff_transformation_2>(const Triangle_2& geo, const Aff_transformation_2& trans) {
+  Kernel::Point_2 v0, v1, v2;
+  if (expansion_transform<Kernel::Point_2>(geo.vertex(0), trans, v0) &&
+      expansion_transform<Kernel::Point_2>(geo.vertex(1), trans, v1) &&
+      expansion_transform<Kernel::Point_2>(geo.vertex(2), trans, v2)) {
+    return Kernel::Triangle_2(v0, v1, v2);
+  }
+  return geo.transform(trans);
+}
+template<>
+inline Triangle_3 transform_impl<Triangle_3, Aff_transformation_3>(const Triangle_3& geo, const Aff_transformation_3& trans) {
+  Kernel::Point_3 v0, v1, v2;
+  if (expansion_transform<Kernel::Point_3>(geo.vertex(0), trans, v0) &&
+      expansion_transform<Kernel::Point_3>(geo.vertex(1), trans, v1) &&
+      expansion_transform<Kernel::Point_3>(geo.vertex(2), trans, v2)) {
+    return Kernel::Triangle_3(v0, v1, v2);
+  }
+  return geo.transform(trans);
+}
 // Work around bug with transformation of weighted points in CGAL
 template<>
 inline Weighted_point_2 transform_impl<Weighted_point_2, Aff_transformation_2>(const Weighted_point_2& geo, const Aff_transformation_2& trans) {
@@ -88,12 +147,18 @@ public:
 
   // Misc
   virtual cpp11::writable::logicals is_reflecting() const = 0;
+  virtual void materialize() const = 0;
+  virtual cpp11::writable::doubles memory_usage() const = 0;
   virtual cpp11::external_pointer<transform_vector_base> prod(bool na_rm) const = 0;
   virtual cpp11::external_pointer<transform_vector_base> cumprod() const = 0;
 };
 
 typedef cpp11::external_pointer<transform_vector_base> transform_vector_base_p;
 
+inline std::string vector_type_name(const transform_vector_base& transforms) {
+  return "affine_transformation";
+}
+
 // General constructor
 template<typename T>
 transform_vector_base_p create_transform_vector(std::vector<T>& input);
@@ -437,18 +502,34 @@ public:
 
     return result;
   }
-  transform_vector_base_p prod(bool na_rm) const {
-    T total(CGAL::IDENTITY);
-
+  void materialize() const {
+    for (size_t i = 0; i < size(); ++i) {
+      materialize_impl(_storage[i]);
+    }
+  }
+  cpp11::writable::doubles memory_usage() const {
+    Memory_usage usage(size(), sizeof(T));
     for (size_t i = 0; i < size(); ++i) {
       if (!_storage[i]) {
-        if (!na_rm) {
-          total = T::NA_value();
-          break;
-        }
         continue;
       }
-      total = total * _storage[i];
+      for (size_t j = 0; j < dim; ++j) {
+        for (size_t k = 0; k <= dim; ++k) {
+          usage.add_accessed_number(_storage[i].m(j, k));
+        }
+      }
+      usage.add_accessed_number(_storage[i].m(dim, dim));
+    }
+    return usage.as_doubles();
+  }
+  transform_vector_base_p prod(bool na_rm) const {
+    T total = T::NA_value();
+    std::vector<T> values;
+
+    if (reduction_values(_storage, na_rm, values)) {
+      total = tree_reduce(values, T(CGAL::IDENTITY), [](const T& a, const T& b) -> T {
+        return a * b;
+      });
     }
     std::vector<T> result;
     result.push_back(total);
@@ -456,24 +537,9 @@ public:
     return create_transform_vector(result);
   }
   transform_vector_base_p cumprod() const {
-    std::vector<T> result;
-    result.reserve(size());
-
-    T cum_prod(CGAL::IDENTITY);
-    bool is_na = false;
-
-    for (size_t i = 0; i < size(); ++i) {
-      if (!is_na && !_storage[i]) {
-        is_na = true;
-        cum_prod = T::NA_value();
-      }
-      if (!is_na) {
-        cum_prod = cum_prod * _storage[i];
-      }
-      result.push_back(cum_prod);
-    }
-
-    return create_transform_vector(result);
+    return create_transform_vector(cumulative_scan(_storage, [](const T& a, const T& b) -> T {
+      return a * b;
+    }));
   }
 };
 
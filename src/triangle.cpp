@@ -3,6 +3,7 @@
 
 [[cpp11::register]]
 triangle2_p create_triangle_2_empty() {
+  Profile_scope profile(__func__);
   std::vector<Triangle_2> vec;
   triangle2 *result(new triangle2(vec));
   return {result};
@@ -10,6 +11,7 @@ triangle2_p create_triangle_2_empty() {
 
 [[cpp11::register]]
 triangle2_p create_triangle_2_3points(point2_p p, point2_p q, point2_p r) {
+  Profile_scope profile(__func__, p);
   std::vector<Triangle_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -26,6 +28,7 @@ triangle2_p create_triangle_2_3points(point2_p p, point2_p q, point2_p r) {
 
 [[cpp11::register]]
 triangle3_p create_triangle_3_empty() {
+  Profile_scope profile(__func__);
   std::vector<Triangle_3> vec;
   triangle3 *result(new triangle3(vec));
   return {result};
@@ -33,6 +36,7 @@ triangle3_p create_triangle_3_empty() {
 
 [[cpp11::register]]
 triangle3_p create_triangle_3_3points(point3_p p, point3_p q, point3_p r) {
+  Profile_scope profile(__func__, p);
   std::vector<Triangle_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -15,6 +15,31 @@ public:
 
   Primitive geometry_type() const { return TRIANGLE; }
 
+  cpp11::writable::logicals has_inside(const geometry_vector_base& points) const {
+    bool handled;
+    cpp11::writable::logicals result = mirror_predicate<Triangle_2, Point_2>(*this, points, Mirror_triangle_side{CGAL::ON_BOUNDED_SIDE, false}, handled);
+    if (handled) {
+      return result;
+    }
+    return geometry_vector::has_inside(points);
+  }
+  cpp11::writable::logicals has_on(const geometry_vector_base& points) const {
+    bool handled;
+    cpp11::writable::logicals result = mirror_predicate<Triangle_2, Point_2>(*this, points, Mirror_triangle_side{CGAL::ON_BOUNDARY, false}, handled);
+    if (handled) {
+      return result;
+    }
+    return geometry_vector::has_on(points);
+  }
+  cpp11::writable::logicals has_outside(const geometry_vector_base& points) const {
+    bool handled;
+    cpp11::writable::logicals result = mirror_predicate<Triangle_2, Point_2>(*this, points, Mirror_triangle_side{CGAL::ON_UNBOUNDED_SIDE, false}, handled);
+    if (handled) {
+      return result;
+    }
+    return geometry_vector::has_outside(points);
+  }
+
   size_t cardinality(size_t i) const { return 3; }
   size_t long_length() const { return size() * 3; }
 
@@ -59,7 +84,14 @@ public:
     switch (other.geometry_type()) {
     case ISORECT: return do_intersect_impl(get_vector_of_geo<Iso_rectangle>(other), _storage);
     case LINE: return do_intersect_impl(get_vector_of_geo<Line_2>(other), _storage);
-    case POINT: return do_intersect_impl(get_vector_of_geo<Point_2>(other), _storage);
+    case POINT: {
+      bool handled;
+      cpp11::writable::logicals result = mirror_predicate<Triangle_2, Point_2>(*this, other, Mirror_triangle_side{CGAL::ON_UNBOUNDED_SIDE, true}, handled);
+      if (handled) {
+        return result;
+      }
+      return do_intersect_impl(get_vector_of_geo<Point_2>(other), _storage);
+    }
     case RAY: return do_intersect_impl(get_vector_of_geo<Ray_2>(other), _storage);
     case SEGMENT: return do_intersect_impl(get_vector_of_geo<Segment_2>(other), _storage);
     case TRIANGLE: return do_intersect_impl(_storage, get_vector_of_geo<Triangle_2>(other));
@@ -0,0 +1,331 @@
+#include "cgal_types.h"
+#include "geometry_vector.h"
+#include "point.h"
+
+#include <cpp11/list.hpp>
+#include <cpp11/matrix.hpp>
+#include <cpp11/external_pointer.hpp>
+
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+#include <CGAL/Regular_triangulation_2.h>
+#include <CGAL/Regular_triangulation_3.h>
+#include <CGAL/Regular_triangulation_vertex_base_2.h>
+#include <CGAL/Regular_triangulation_face_base_2.h>
+#include <CGAL/Regular_triangulation_vertex_base_3.h>
+#include <CGAL/Regular_triangulation_cell_base_3.h>
+
+typedef CGAL::Triangulation_vertex_base_with_info_2<int, Kernel> Dt_vertex_2;
+typedef CGAL::Triangulation_data_structure_2<Dt_vertex_2> Dt_tds_2;
+typedef CGAL::Delaunay_triangulation_2<Kernel, Dt_tds_2> Delaunay_2;
+
+typedef CGAL::Triangulation_vertex_base_with_info_3<int, Kernel> Dt_vertex_3;
+typedef CGAL::Triangulation_data_structure_3<Dt_vertex_3> Dt_tds_3;
+// Sequential tag only, see the note on threading in cgal_types.h
+typedef CGAL::Delaunay_triangulation_3<Kernel, Dt_tds_3> Delaunay_3;
+
+typedef CGAL::Regular_triangulation_vertex_base_2<Kernel> Rt_vertex_base_2;
+typedef CGAL::Triangulation_vertex_base_with_info_2<int, Kernel, Rt_vertex_base_2> Rt_vertex_2;
+typedef CGAL::Regular_triangulation_face_base_2<Kernel> Rt_face_2;
+typedef CGAL::Triangulation_data_structure_2<Rt_vertex_2, Rt_face_2> Rt_tds_2;
+typedef CGAL::Regular_triangulation_2<Kernel, Rt_tds_2> Regular_2;
+
+typedef CGAL::Regular_triangulation_vertex_base_3<Kernel> Rt_vertex_base_3;
+typedef CGAL::Triangulation_vertex_base_with_info_3<int, Kernel, Rt_vertex_base_3> Rt_vertex_3;
+typedef CGAL::Regular_triangulation_cell_base_3<Kernel> Rt_cell_3;
+typedef CGAL::Triangulation_data_structure_3<Rt_vertex_3, Rt_cell_3> Rt_tds_3;
+typedef CGAL::Regular_triangulation_3<Kernel, Rt_tds_3> Regular_3;
+
+// Collects the valid points along with their (0-based) position in the input
+// so that the vertices of the triangulation can be mapped back to the input.
+// The triangulation will spatially sort the range before insertion
+template<typename Point, typename T>
+inline std::vector< std::pair<Point, int> > indexed_points(const std::vector<T>& points) {
+  std::vector< std::pair<Point, int> > result;
+  result.reserve(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (!points[i]) {
+      continue;
+    }
+    result.emplace_back(points[i], i);
+  }
+  return result;
+}
+
+// As above, but keeps only the first occurrence of duplicated points. The
+// triangulation merges duplicates itself, but as the input is spatially
+// sorted the info of the surviving vertex could come from any of them
+template<typename Point, typename T>
+inline std::vector< std::pair<Point, int> > unique_indexed_points(const std::vector<T>& points) {
+  std::vector< std::pair<Point, int> > result = indexed_points<Point>(points);
+  std::stable_sort(result.begin(), result.end(), [](const std::pair<Point, int>& a, const std::pair<Point, int>& b) {
+    return a.first < b.first;
+  });
+  auto last = std::unique(result.begin(), result.end(), [](const std::pair<Point, int>& a, const std::pair<Point, int>& b) {
+    return a.first == b.first;
+  });
+  result.erase(last, result.end());
+  return result;
+}
+
+[[cpp11::register]]
+cpp11::writable::list geometry_delaunay_triangulation(geometry_vector_base_p points) {
+  Profile_scope profile(__func__, points);
+  if (points.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  if (points->geometry_type() != POINT) {
+    cpp11::stop("Delaunay triangulation is only defined for points");
+  }
+  cpp11::writable::list result;
+
+  if (points->dimensions() == 2) {
+    std::vector<Point_2> vec = get_vector_of_geo<Point_2>(*points);
+    Delaunay_2 dt;
+    auto input = unique_indexed_points<Kernel::Point_2>(vec);
+    dt.insert(input.begin(), input.end());
+
+    std::vector<Triangle_2> triangles;
+    triangles.reserve(dt.number_of_faces());
+    cpp11::writable::integers_matrix index(dt.number_of_faces(), 3);
+    size_t i = 0;
+    for (auto face = dt.finite_faces_begin(); face != dt.finite_faces_end(); ++face) {
+      triangles.emplace_back(
+        face->vertex(0)->point(),
+        face->vertex(1)->point(),
+        face->vertex(2)->point()
+      );
+      for (int j = 0; j < 3; ++j) {
+        index(i, j) = face->vertex(j)->info() + 1;
+      }
+      ++i;
+    }
+    result.push_back(create_geometry_vector(triangles));
+    result.push_back(index);
+  } else {
+    std::vector<Point_3> vec = get_vector_of_geo<Point_3>(*points);
+    Delaunay_3 dt;
+    auto input = unique_indexed_points<Kernel::Point_3>(vec);
+    dt.insert(input.begin(), input.end());
+
+    // Only a full dimensional triangulation contains tetrahedra
+    size_t n_cells = dt.dimension() == 3 ? dt.number_of_finite_cells() : 0;
+    std::vector<Tetrahedron> tetrahedra;
+    tetrahedra.reserve(n_cells);
+    cpp11::writable::integers_matrix index(n_cells, 4);
+    if (n_cells > 0) {
+      size_t i = 0;
+      for (auto cell = dt.finite_cells_begin(); cell != dt.finite_cells_end(); ++cell) {
+        tetrahedra.emplace_back(
+          cell->vertex(0)->point(),
+          cell->vertex(1)->point(),
+          cell->vertex(2)->point(),
+          cell->vertex(3)->point()
+        );
+        for (int j = 0; j < 4; ++j) {
+          index(i, j) = cell->vertex(j)->info() + 1;
+        }
+        ++i;
+      }
+    }
+    result.push_back(create_geometry_vector(tetrahedra));
+    result.push_back(index);
+  }
+
+  return result;
+}
+
+// The regular triangulation is returned together with its dual, the power
+// diagram. Each finite edge of the triangulation connects two adjacent power
+// cells and each finite face (cell in 3D) is dual to a vertex of the power
+// diagram, its power center. The power cell of each input point is given as
+// the (1-based) power centers of the faces around its vertex, split by the
+// point index, along with whether the cell is unbounded. Hidden and NA points
+// have no cell and an NA flag
+[[cpp11::register]]
+cpp11::writable::list geometry_regular_triangulation(geometry_vector_base_p points) {
+  Profile_scope profile(__func__, points);
+  if (points.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  if (points->geometry_type() != WPOINT) {
+    cpp11::stop("Regular triangulation is only defined for weighted points");
+  }
+  cpp11::writable::list result;
+
+  if (points->dimensions() == 2) {
+    std::vector<Weighted_point_2> vec = get_vector_of_geo<Weighted_point_2>(*points);
+    Regular_2 rt;
+    auto input = indexed_points<Kernel::Weighted_point_2>(vec);
+    rt.insert(input.begin(), input.end());
+
+    size_t n_faces = rt.dimension() == 2 ? rt.number_of_faces() : 0;
+    std::vector<Triangle_2> triangles;
+    std::vector<Point_2> centers;
+    triangles.reserve(n_faces);
+    centers.reserve(n_faces);
+    cpp11::writable::integers_matrix index(n_faces, 3);
+    std::map<Regular_2::Face_handle, int> face_index;
+    if (n_faces > 0) {
+      size_t i = 0;
+      for (auto face = rt.finite_faces_begin(); face != rt.finite_faces_end(); ++face) {
+        face_index[face] = i;
+        triangles.emplace_back(
+          face->vertex(0)->point().point(),
+          face->vertex(1)->point().point(),
+          face->vertex(2)->point().point()
+        );
+        centers.push_back(rt.dual(face));
+        for (int j = 0; j < 3; ++j) {
+          index(i, j) = face->vertex(j)->info() + 1;
+        }
+        ++i;
+      }
+    }
+
+    size_t n_edges = rt.dimension() > 0 ? std::distance(rt.finite_edges_begin(), rt.finite_edges_end()) : 0;
+    cpp11::writable::integers_matrix edges(n_edges, 2);
+    if (n_edges > 0) {
+      size_t i = 0;
+      for (auto edge = rt.finite_edges_begin(); edge != rt.finite_edges_end(); ++edge) {
+        edges(i, 0) = edge->first->vertex(rt.cw(edge->second))->info() + 1;
+        edges(i, 1) = edge->first->vertex(rt.ccw(edge->second))->info() + 1;
+        ++i;
+      }
+    }
+
+    cpp11::writable::integers cell_center;
+    cpp11::writable::integers cell_point;
+    cpp11::writable::logicals unbounded(vec.size());
+    for (size_t i = 0; i < vec.size(); ++i) {
+      unbounded[i] = NA_LOGICAL;
+    }
+    for (auto v = rt.finite_vertices_begin(); v != rt.finite_vertices_end(); ++v) {
+      if (n_faces == 0) {
+        unbounded[v->info()] = TRUE;
+        continue;
+      }
+      // Faces circulate counterclockwise. Starting after an infinite face keeps
+      // the centers of unbounded cells in order along their boundary
+      auto first = rt.incident_faces(v);
+      auto face = first;
+      do {
+        if (rt.is_infinite(face)) {
+          first = face;
+          break;
+        }
+      } while (++face != first);
+      bool is_unbounded = false;
+      face = first;
+      do {
+        if (rt.is_infinite(face)) {
+          is_unbounded = true;
+          continue;
+        }
+        Regular_2::Face_handle handle = face;
+        cell_center.push_back(face_index[handle] + 1);
+        cell_point.push_back(v->info() + 1);
+      } while (++face != first);
+      unbounded[v->info()] = (Rboolean) is_unbounded;
+    }
+
+    result.push_back(create_geometry_vector(triangles));
+    result.push_back(index);
+    result.push_back(edges);
+    result.push_back(create_geometry_vector(centers));
+    result.push_back(cell_center);
+    result.push_back(cell_point);
+    result.push_back(unbounded);
+  } else {
+    std::vector<Weighted_point_3> vec = get_vector_of_geo<Weighted_point_3>(*points);
+    Regular_3 rt;
+    auto input = indexed_points<Kernel::Weighted_point_3>(vec);
+    rt.insert(input.begin(), input.end());
+
+    size_t n_cells = rt.dimension() == 3 ? rt.number_of_finite_cells() : 0;
+    std::vector<Tetrahedron> tetrahedra;
+    std::vector<Point_3> centers;
+    tetrahedra.reserve(n_cells);
+    centers.reserve(n_cells);
+    cpp11::writable::integers_matrix index(n_cells, 4);
+    std::map<Regular_3::Cell_handle, int> cell_index;
+    if (n_cells > 0) {
+      size_t i = 0;
+      for (auto cell = rt.finite_cells_begin(); cell != rt.finite_cells_end(); ++cell) {
+        cell_index[cell] = i;
+        tetrahedra.emplace_back(
+          cell->vertex(0)->point().point(),
+          cell->vertex(1)->point().point(),
+          cell->vertex(2)->point().point(),
+          cell->vertex(3)->point().point()
+        );
+        centers.push_back(rt.dual(cell));
+        for (int j = 0; j < 4; ++j) {
+          index(i, j) = cell->vertex(j)->info() + 1;
+        }
+        ++i;
+      }
+    }
+
+    size_t n_edges = rt.dimension() > 0 ? rt.number_of_finite_edges() : 0;
+    cpp11::writable::integers_matrix edges(n_edges, 2);
+    if (n_edges > 0) {
+      size_t i = 0;
+      for (auto edge = rt.finite_edges_begin(); edge != rt.finite_edges_end(); ++edge) {
+        edges(i, 0) = edge->first->vertex(edge->second)->info() + 1;
+        edges(i, 1) = edge->first->vertex(edge->third)->info() + 1;
+        ++i;
+      }
+    }
+
+    cpp11::writable::integers cell_center;
+    cpp11::writable::integers cell_point;
+    cpp11::writable::logicals unbounded(vec.size());
+    for (size_t i = 0; i < vec.size(); ++i) {
+      unbounded[i] = NA_LOGICAL;
+    }
+    std::vector<Regular_3::Cell_handle> incident;
+    std::vector<int> around;
+    for (auto v = rt.finite_vertices_begin(); v != rt.finite_vertices_end(); ++v) {
+      if (n_cells == 0) {
+        unbounded[v->info()] = TRUE;
+        continue;
+      }
+      // Cells around a vertex have no natural order in 3D so the centers are
+      // given in the order of the tetrahedra
+      incident.clear();
+      around.clear();
+      rt.incident_cells(v, std::back_inserter(incident));
+      bool is_unbounded = false;
+      for (auto cell = incident.begin(); cell != incident.end(); ++cell) {
+        if (rt.is_infinite(*cell)) {
+          is_unbounded = true;
+          continue;
+        }
+        around.push_back(cell_index[*cell] + 1);
+      }
+      std::sort(around.begin(), around.end());
+      for (auto iter = around.begin(); iter != around.end(); ++iter) {
+        cell_center.push_back(*iter);
+        cell_point.push_back(v->info() + 1);
+      }
+      unbounded[v->info()] = (Rboolean) is_unbounded;
+    }
+
+    result.push_back(create_geometry_vector(tetrahedra));
+    result.push_back(index);
+    result.push_back(edges);
+    result.push_back(create_geometry_vector(centers));
+    result.push_back(cell_center);
+    result.push_back(cell_point);
+    result.push_back(unbounded);
+  }
+
+  return result;
+}
@@ -0,0 +1,273 @@
+#include "cgal_types.h"
+#include "geometry_vector.h"
+#include "exact_numeric.h"
+#include "reduce.h"
+
+#include <cpp11/external_pointer.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <set>
+#include <map>
+
+// Segment tree over the elementary intervals between the sorted unique
+// y-coordinates of the rectangles. For each node it tracks how many
+// rectangles fully covers it along with the length within it that is covered
+// by at least one or at least two rectangles, depending on the measure asked for
+class Coverage_tree {
+  std::vector<Kernel::FT> _coords;
+  int _min_count;
+  std::vector<int> _count;
+  std::vector<Kernel::FT> _covered;
+  std::vector<Kernel::FT> _overlapped;
+
+  void pull(size_t node, size_t lo, size_t hi) {
+    bool leaf = hi - lo == 1;
+    if (_min_count == 1) {
+      if (_count[node] >= 1) {
+        _covered[node] = _coords[hi] - _coords[lo];
+      } else {
+        _covered[node] = leaf ? Kernel::FT(0) : _covered[2 * node] + _covered[2 * node + 1];
+      }
+      return;
+    }
+    // Overlap requires the length covered by at least one rectangle as well
+    Kernel::FT full = _coords[hi] - _coords[lo];
+    if (_count[node] >= 2) {
+      _covered[node] = full;
+      _overlapped[node] = full;
+    } else if (_count[node] == 1) {
+      _covered[node] = full;
+      _overlapped[node] = leaf ? Kernel::FT(0) : _covered[2 * node] + _covered[2 * node + 1];
+    } else {
+      _covered[node] = leaf ? Kernel::FT(0) : _covered[2 * node] + _covered[2 * node + 1];
+      _overlapped[node] = leaf ? Kernel::FT(0) : _overlapped[2 * node] + _overlapped[2 * node + 1];
+    }
+  }
+  void update(size_t node, size_t lo, size_t hi, size_t from, size_t to, int delta) {
+    if (to <= lo || hi <= from) {
+      return;
+    }
+    if (from <= lo && hi <= to) {
+      _count[node] += delta;
+    } else {
+      size_t mid = (lo + hi) / 2;
+      update(2 * node, lo, mid, from, to, delta);
+      update(2 * node + 1, mid, hi, from, to, delta);
+    }
+    pull(node, lo, hi);
+  }
+
+public:
+  Coverage_tree(const std::vector<Kernel::FT>& coords, int min_count) :
+    _coords(coords),
+    _min_count(min_count),
+    _count(4 * coords.size(), 0),
+    _covered(4 * coords.size(), Kernel::FT(0)),
+    _overlapped(min_count == 1 ? 0 : 4 * coords.size(), Kernel::FT(0)) {}
+
+  void add(size_t from, size_t to, int delta) {
+    if (_coords.size() < 2 || from >= to) {
+      return;
+    }
+    update(1, 0, _coords.size() - 1, from, to, delta);
+  }
+  // The length covered by at least `min_count` rectangles
+  Kernel::FT measure() const {
+    if (_coords.size() < 2) {
+      return Kernel::FT(0);
+    }
+    return _min_count == 1 ? _covered[1] : _overlapped[1];
+  }
+};
+
+struct Sweep_event {
+  Kernel::FT x;
+  Kernel::FT y_lo;
+  Kernel::FT y_hi;
+  int delta;
+};
+
+inline bool operator<(const Sweep_event& a, const Sweep_event& b) {
+  return a.x < b.x;
+}
+
+inline size_t coord_index(const std::vector<Kernel::FT>& coords, const Kernel::FT& val) {
+  return std::lower_bound(coords.begin(), coords.end(), val) - coords.begin();
+}
+
+inline Kernel::FT sum_terms(const std::vector<Kernel::FT>& terms) {
+  return tree_reduce(terms, Kernel::FT(0), [](const Kernel::FT& a, const Kernel::FT& b) -> Kernel::FT {
+    return a + b;
+  });
+}
+
+// Sweeps a line along x over events sorted by x while maintaining the covered
+// length along y. `coords` are the sorted unique y-coordinates of the events.
+// The area of each strip between events is collected and summed pairwise to
+// keep the resulting expression shallow
+template<typename Iter>
+inline Kernel::FT sweep_area(const std::vector<Kernel::FT>& coords, Iter begin, Iter end, int min_count) {
+  Coverage_tree tree(coords, min_count);
+  std::vector<Kernel::FT> strips;
+  for (Iter iter = begin; iter != end; ++iter) {
+    if (iter != begin) {
+      Iter prev = iter;
+      --prev;
+      if (iter->x != prev->x) {
+        strips.push_back(tree.measure() * (iter->x - prev->x));
+      }
+    }
+    tree.add(coord_index(coords, iter->y_lo), coord_index(coords, iter->y_hi), iter->delta);
+  }
+  return sum_terms(strips);
+}
+
+// Klee's measure in the plane. Returns the area covered by at least
+// `min_count` (1 or 2) rectangles in O(n log n) time
+inline Kernel::FT union_area_impl(const std::vector<Kernel::Iso_rectangle_2>& rects, int min_count) {
+  std::vector<Kernel::FT> coords;
+  std::vector<Sweep_event> events;
+  coords.reserve(2 * rects.size());
+  events.reserve(2 * rects.size());
+  for (auto iter = rects.begin(); iter != rects.end(); ++iter) {
+    if (iter->is_degenerate()) {
+      continue;
+    }
+    coords.push_back(iter->ymin());
+    coords.push_back(iter->ymax());
+    events.push_back({iter->xmin(), iter->ymin(), iter->ymax(), 1});
+    events.push_back({iter->xmax(), iter->ymin(), iter->ymax(), -1});
+  }
+  std::sort(coords.begin(), coords.end());
+  coords.erase(std::unique(coords.begin(), coords.end()), coords.end());
+  std::sort(events.begin(), events.end());
+
+  return sweep_area(coords, events.begin(), events.end(), min_count);
+}
+
+struct Level_event {
+  Kernel::FT z;
+  size_t index;
+  bool insert;
+};
+
+inline bool operator<(const Level_event& a, const Level_event& b) {
+  return a.z < b.z;
+}
+
+// The 3D measure is found by sweeping a plane along z. The cross-sections of
+// the cuboids intersecting the plane are kept in an active set, with their
+// x-events sorted and their y-coordinates counted, so entering and leaving
+// cuboids are logarithmic updates. The coverage itself is not maintained
+// between slabs: the area of each slab is swept anew over the k active
+// cross-sections in O(k log k), giving O(n k log k) overall and O(n^2 log n)
+// when all cuboids overlap along z
+inline Kernel::FT union_volume_impl(const std::vector<Kernel::Iso_cuboid_3>& cubes, int min_count) {
+  std::vector<Level_event> levels;
+  levels.reserve(2 * cubes.size());
+  for (size_t i = 0; i < cubes.size(); ++i) {
+    if (cubes[i].is_degenerate()) {
+      continue;
+    }
+    levels.push_back({cubes[i].zmin(), i, true});
+    levels.push_back({cubes[i].zmax(), i, false});
+  }
+  std::sort(levels.begin(), levels.end());
+
+  typedef std::multiset<Sweep_event>::iterator Event_iter;
+  std::multiset<Sweep_event> events;
+  std::vector<std::pair<Event_iter, Event_iter> > active(cubes.size());
+  std::map<Kernel::FT, size_t> y_counts;
+  std::vector<Kernel::FT> coords;
+
+  std::vector<Kernel::FT> slabs;
+  size_t i = 0;
+  while (i < levels.size()) {
+    Kernel::FT z = levels[i].z;
+    for (; i < levels.size() && levels[i].z == z; ++i) {
+      const Kernel::Iso_cuboid_3& cube = cubes[levels[i].index];
+      if (levels[i].insert) {
+        active[levels[i].index] = std::make_pair(
+          events.insert({cube.xmin(), cube.ymin(), cube.ymax(), 1}),
+          events.insert({cube.xmax(), cube.ymin(), cube.ymax(), -1})
+        );
+        ++y_counts[cube.ymin()];
+        ++y_counts[cube.ymax()];
+      } else {
+        events.erase(active[levels[i].index].first);
+        events.erase(active[levels[i].index].second);
+        if (--y_counts[cube.ymin()] == 0) {
+          y_counts.erase(cube.ymin());
+        }
+        if (--y_counts[cube.ymax()] == 0) {
+          y_counts.erase(cube.ymax());
+        }
+      }
+    }
+    if (i == levels.size() || events.size() < 2 * size_t(min_count)) {
+      continue;
+    }
+    coords.clear();
+    for (auto iter = y_counts.begin(); iter != y_counts.end(); ++iter) {
+      coords.push_back(iter->first);
+    }
+    slabs.push_back(sweep_area(coords, events.begin(), events.end(), min_count) * (levels[i].z - z));
+  }
+  return sum_terms(slabs);
+}
+
+template<typename T, typename U>
+inline std::vector<U> valid_geometries(const std::vector<T>& geometries, bool na_rm, bool& is_na) {
+  std::vector<U> result;
+  result.reserve(geometries.size());
+  is_na = false;
+  for (auto iter = geometries.begin(); iter != geometries.end(); ++iter) {
+    if (!(*iter)) {
+      if (!na_rm) {
+        is_na = true;
+        break;
+      }
+      continue;
+    }
+    result.push_back(*iter);
+  }
+  return result;
+}
+
+[[cpp11::register]]
+exact_numeric_p geometry_union_measure(geometry_vector_base_p geometries, bool overlap, bool na_rm) {
+  Profile_scope profile(__func__, geometries);
+  if (geometries.get() == nullptr) {
+    cpp11::stop("Data structure pointer cleared from memory");
+  }
+  int min_count = overlap ? 2 : 1;
+  Kernel::FT measure;
+  bool is_na = false;
+  switch (geometries->geometry_type()) {
+  case ISORECT: {
+    auto rects = valid_geometries<Iso_rectangle, Kernel::Iso_rectangle_2>(get_vector_of_geo<Iso_rectangle>(*geometries), na_rm, is_na);
+    if (!is_na) {
+      measure = union_area_impl(rects, min_count);
+    }
+    break;
+  }
+  case ISOCUBE: {
+    auto cubes = valid_geometries<Iso_cuboid, Kernel::Iso_cuboid_3>(get_vector_of_geo<Iso_cuboid>(*geometries), na_rm, is_na);
+    if (!is_na) {
+      measure = union_volume_impl(cubes, min_count);
+    }
+    break;
+  }
+  default: cpp11::stop("Union measures are only defined for iso rectangles and iso cubes");
+  }
+
+  std::vector<Exact_number> result;
+  if (is_na) {
+    result.push_back(Exact_number::NA_value());
+  } else {
+    result.push_back(measure);
+  }
+  exact_numeric* vec(new exact_numeric(result));
+  return {vec};
+}
@@ -10,6 +10,7 @@
 
 [[cpp11::register]]
 vector2_p create_vector_2_empty() {
+  Profile_scope profile(__func__);
   std::vector<Vector_2> vec;
   vector2 *result(new vector2(vec));
   return {result};
@@ -17,6 +18,7 @@ vector2_p create_vector_2_empty() {
 
 [[cpp11::register]]
 vector2_p create_vector_2_point(point2_p p) {
+  Profile_scope profile(__func__, p);
   std::vector<Vector_2> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -33,6 +35,7 @@ vector2_p create_vector_2_point(point2_p p) {
 
 [[cpp11::register]]
 vector2_p create_vector_2_ray(ray2_p r) {
+  Profile_scope profile(__func__, r);
   std::vector<Vector_2> vec;
   vec.reserve(r->size());
   for (size_t i = 0; i < r->size(); ++i) {
@@ -49,6 +52,7 @@ vector2_p create_vector_2_ray(ray2_p r) {
 
 [[cpp11::register]]
 vector2_p create_vector_2_segment(segment2_p s) {
+  Profile_scope profile(__func__, s);
   std::vector<Vector_2> vec;
   vec.reserve(s->size());
   for (size_t i = 0; i < s->size(); ++i) {
@@ -65,6 +69,7 @@ vector2_p create_vector_2_segment(segment2_p s) {
 
 [[cpp11::register]]
 vector2_p create_vector_2_line(line2_p l) {
+  Profile_scope profile(__func__, l);
   std::vector<Vector_2> vec;
   vec.reserve(l->size());
   for (size_t i = 0; i < l->size(); ++i) {
@@ -81,6 +86,7 @@ vector2_p create_vector_2_line(line2_p l) {
 
 [[cpp11::register]]
 vector2_p create_vector_2_direction(direction2_p d) {
+  Profile_scope profile(__func__, d);
   std::vector<Vector_2> vec;
   vec.reserve(d->size());
   for (size_t i = 0; i < d->size(); ++i) {
@@ -97,6 +103,7 @@ vector2_p create_vector_2_direction(direction2_p d) {
 
 [[cpp11::register]]
 vector2_p create_vector_2_x_y(exact_numeric_p x, exact_numeric_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_2> vec;
   vec.reserve(x->size());
   for (size_t i = 0; i < x->size(); ++i) {
@@ -113,6 +120,7 @@ vector2_p create_vector_2_x_y(exact_numeric_p x, exact_numeric_p y) {
 
 [[cpp11::register]]
 vector2_p vector_2_add_vector(vector2_p x, vector2_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_2> vec = (*x) + y->get_storage();
   vector2 *result(new vector2(vec));
 
@@ -121,6 +129,7 @@ vector2_p vector_2_add_vector(vector2_p x, vector2_p y) {
 
 [[cpp11::register]]
 vector2_p vector_2_minus_vector(vector2_p x, vector2_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_2> vec = (*x) - y->get_storage();
   vector2 *result(new vector2(vec));
 
@@ -129,6 +138,7 @@ vector2_p vector_2_minus_vector(vector2_p x, vector2_p y) {
 
 [[cpp11::register]]
 vector2_p vector_2_negate(vector2_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_2> vec = -(*x);
   vector2 *result(new vector2(vec));
 
@@ -137,6 +147,7 @@ vector2_p vector_2_negate(vector2_p x) {
 
 [[cpp11::register]]
 exact_numeric_p vector_2_dot_vector(vector2_p x, vector2_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Exact_number> vec = (*x) * y->get_storage();
   exact_numeric *result(new exact_numeric(vec));
 
@@ -145,6 +156,7 @@ exact_numeric_p vector_2_dot_vector(vector2_p x, vector2_p y) {
 
 [[cpp11::register]]
 vector2_p vector_2_times_numeric(vector2_p x, exact_numeric_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_2> vec = (*x) * y->get_storage();
   vector2 *result(new vector2(vec));
 
@@ -153,6 +165,7 @@ vector2_p vector_2_times_numeric(vector2_p x, exact_numeric_p y) {
 
 [[cpp11::register]]
 vector2_p vector_2_divide_numeric(vector2_p x, exact_numeric_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_2> vec = (*x) / y->get_storage();
   vector2 *result(new vector2(vec));
 
@@ -161,6 +174,7 @@ vector2_p vector_2_divide_numeric(vector2_p x, exact_numeric_p y) {
 
 [[cpp11::register]]
 vector2_p vector_2_sum(vector2_p x, bool na_rm) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_2> vec = x->sum(na_rm);
   vector2 *result(new vector2(vec));
 
@@ -169,6 +183,7 @@ vector2_p vector_2_sum(vector2_p x, bool na_rm) {
 
 [[cpp11::register]]
 vector2_p vector_2_cumsum(vector2_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_2> vec = x->cumsum();
   vector2 *result(new vector2(vec));
 
@@ -177,6 +192,7 @@ vector2_p vector_2_cumsum(vector2_p x) {
 
 [[cpp11::register]]
 vector3_p create_vector_3_empty() {
+  Profile_scope profile(__func__);
   std::vector<Vector_3> vec;
   vector3 *result(new vector3(vec));
   return {result};
@@ -184,6 +200,7 @@ vector3_p create_vector_3_empty() {
 
 [[cpp11::register]]
 vector3_p create_vector_3_point(point3_p p) {
+  Profile_scope profile(__func__, p);
   std::vector<Vector_3> vec;
   vec.reserve(p->size());
   for (size_t i = 0; i < p->size(); ++i) {
@@ -200,6 +217,7 @@ vector3_p create_vector_3_point(point3_p p) {
 
 [[cpp11::register]]
 vector3_p create_vector_3_ray(ray3_p r) {
+  Profile_scope profile(__func__, r);
   std::vector<Vector_3> vec;
   vec.reserve(r->size());
   for (size_t i = 0; i < r->size(); ++i) {
@@ -216,6 +234,7 @@ vector3_p create_vector_3_ray(ray3_p r) {
 
 [[cpp11::register]]
 vector3_p create_vector_3_segment(segment3_p s) {
+  Profile_scope profile(__func__, s);
   std::vector<Vector_3> vec;
   vec.reserve(s->size());
   for (size_t i = 0; i < s->size(); ++i) {
@@ -232,6 +251,7 @@ vector3_p create_vector_3_segment(segment3_p s) {
 
 [[cpp11::register]]
 vector3_p create_vector_3_line(line3_p l) {
+  Profile_scope profile(__func__, l);
   std::vector<Vector_3> vec;
   vec.reserve(l->size());
   for (size_t i = 0; i < l->size(); ++i) {
@@ -248,6 +268,7 @@ vector3_p create_vector_3_line(line3_p l) {
 
 [[cpp11::register]]
 vector3_p create_vector_3_direction(direction3_p d) {
+  Profile_scope profile(__func__, d);
   std::vector<Vector_3> vec;
   vec.reserve(d->size());
   for (size_t i = 0; i < d->size(); ++i) {
@@ -264,6 +285,7 @@ vector3_p create_vector_3_direction(direction3_p d) {
 
 [[cpp11::register]]
 vector3_p create_vector_3_x_y_z(exact_numeric_p x, exact_numeric_p y, exact_numeric_p z) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_3> vec;
   vec.reserve(x->size());
   for (size_t i = 0; i < x->size(); ++i) {
@@ -280,6 +302,7 @@ vector3_p create_vector_3_x_y_z(exact_numeric_p x, exact_numeric_p y, exact_nume
 
 [[cpp11::register]]
 vector3_p vector_3_add_vector(vector3_p x, vector3_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_3> vec = (*x) + y->get_storage();
   vector3 *result(new vector3(vec));
 
@@ -288,6 +311,7 @@ vector3_p vector_3_add_vector(vector3_p x, vector3_p y) {
 
 [[cpp11::register]]
 vector3_p vector_3_minus_vector(vector3_p x, vector3_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_3> vec = (*x) - y->get_storage();
   vector3 *result(new vector3(vec));
 
@@ -296,6 +320,7 @@ vector3_p vector_3_minus_vector(vector3_p x, vector3_p y) {
 
 [[cpp11::register]]
 vector3_p vector_3_negate(vector3_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_3> vec = -(*x);
   vector3 *result(new vector3(vec));
 
@@ -304,6 +329,7 @@ vector3_p vector_3_negate(vector3_p x) {
 
 [[cpp11::register]]
 exact_numeric_p vector_3_dot_vector(vector3_p x, vector3_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Exact_number> vec = (*x) * y->get_storage();
   exact_numeric *result(new exact_numeric(vec));
 
@@ -312,6 +338,7 @@ exact_numeric_p vector_3_dot_vector(vector3_p x, vector3_p y) {
 
 [[cpp11::register]]
 vector3_p vector_3_times_numeric(vector3_p x, exact_numeric_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_3> vec = (*x) * y->get_storage();
   vector3 *result(new vector3(vec));
 
@@ -320,6 +347,7 @@ vector3_p vector_3_times_numeric(vector3_p x, exact_numeric_p y) {
 
 [[cpp11::register]]
 vector3_p vector_3_divide_numeric(vector3_p x, exact_numeric_p y) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_3> vec = (*x) / y->get_storage();
   vector3 *result(new vector3(vec));
 
@@ -328,6 +356,7 @@ vector3_p vector_3_divide_numeric(vector3_p x, exact_numeric_p y) {
 
 [[cpp11::register]]
 vector3_p vector_3_sum(vector3_p x, bool na_rm) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_3> vec = x->sum(na_rm);
   vector3 *result(new vector3(vec));
 
@@ -336,6 +365,7 @@ vector3_p vector_3_sum(vector3_p x, bool na_rm) {
 
 [[cpp11::register]]
 vector3_p vector_3_cumsum(vector3_p x) {
+  Profile_scope profile(__func__, x);
   std::vector<Vector_3> vec = x->cumsum();
   vector3 *result(new vector3(vec));
 
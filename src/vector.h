@@ -112,10 +112,10 @@ public:
     result.reserve(final_size);
     for (size_t i = 0; i < final_size; ++i) {
       if (!_storage[i % size()] || !other[i % other.size()]) {
-        result[i] = Exact_number::NA_value();
+        result.push_back(Exact_number::NA_value());
         continue;
       }
-      result.push_back(_storage[i % size()] * other[i % other.size()]);
+      result.push_back(fused_dot(_storage[i % size()], other[i % other.size()]));
     }
     return result;
   }
@@ -155,45 +155,21 @@ public:
     if (size() == 0) {
       return {};
     }
-    Vector_2 total = _storage[0];
+    Vector_2 total = Vector_2::NA_value();
+    std::vector<Vector_2> values;
 
-    for (size_t i = 1; i < size(); ++i) {
-      if (!_storage[i]) {
-        if (!na_rm) {
-          total = Vector_2::NA_value();
-          break;
-        }
-        continue;
-      }
-      total += _storage[i];
+    if (reduction_values(_storage, na_rm, values)) {
+      total = tree_reduce(values, Vector_2(CGAL::NULL_VECTOR), [](const Vector_2& a, const Vector_2& b) -> Vector_2 {
+        return a + b;
+      });
     }
 
     return {total};
   }
   std::vector<Vector_2> cumsum() const {
-    std::vector<Vector_2> result;
-    result.reserve(size());
-
-    if (size() == 0) {
-      return {result};
-    }
-
-    Vector_2 cum_sum = _storage[0];
-    result.push_back(cum_sum);
-    bool is_na = false;
-
-    for (size_t i = 1; i < size(); ++i) {
-      if (!is_na && !_storage[i]) {
-        is_na = true;
-        cum_sum = Vector_2::NA_value();
-      }
-      if (!is_na) {
-        cum_sum += _storage[i];
-      }
-      result.push_back(cum_sum);
-    }
-
-    return {result};
+    return cumulative_scan(_storage, [](const Vector_2& a, const Vector_2& b) -> Vector_2 {
+      return a + b;
+    });
   }
 };
 
@@ -305,10 +281,10 @@ public:
     result.reserve(final_size);
     for (size_t i = 0; i < final_size; ++i) {
       if (!_storage[i % size()] || !other[i % other.size()]) {
-        result[i] = Exact_number::NA_value();
+        result.push_back(Exact_number::NA_value());
         continue;
       }
-      result.push_back(_storage[i % size()] * other[i % other.size()]);
+      result.push_back(fused_dot(_storage[i % size()], other[i % other.size()]));
     }
     return {result};
   }
@@ -348,45 +324,21 @@ public:
     if (size() == 0) {
       return {};
     }
-    Vector_3 total = _storage[0];
+    Vector_3 total = Vector_3::NA_value();
+    std::vector<Vector_3> values;
 
-    for (size_t i = 1; i < size(); ++i) {
-      if (!_storage[i]) {
-        if (!na_rm) {
-          total = Vector_3::NA_value();
-          break;
-        }
-        continue;
-      }
-      total += _storage[i];
+    if (reduction_values(_storage, na_rm, values)) {
+      total = tree_reduce(values, Vector_3(CGAL::NULL_VECTOR), [](const Vector_3& a, const Vector_3& b) -> Vector_3 {
+        return a + b;
+      });
     }
 
     return {total};
   }
   std::vector<Vector_3> cumsum() const {
-    std::vector<Vector_3> result;
-    result.reserve(size());
-
-    if (size() == 0) {
-      return {result};
-    }
-
-    Vector_3 cum_sum = _storage[0];
-    result.push_back(cum_sum);
-    bool is_na = false;
-
-    for (size_t i = 1; i < size(); ++i) {
-      if (!is_na && !_storage[i]) {
-        is_na = true;
-        cum_sum = Vector_3::NA_value();
-      }
-      if (!is_na) {
-        cum_sum += _storage[i];
-      }
-      result.push_back(cum_sum);
-    }
-
-    return {result};
+    return cumulative_scan(_storage, [](const Vector_3& a, const Vector_3& b) -> Vector_3 {
+      return a + b;
+    });
   }
 };
 